@@ -0,0 +1,178 @@
+/*
+Benchmark of every pipeline stage over synthetic iscripts.
+
+For each size, a deterministic synthetic iscript is generated and then
+ - decoded by the IScript constructor, on -t threads,
+ - walked by UpdateDependency for every entry,
+ - fixed onto a tiny synthetic original, with allocation ([3]-[4] minus
+   decoding) and payload emission ([5]) taken from FixIScript's own
+   phase timers.
+Each stage runs several times and the median is reported, with decode
+throughput, model memory and peak memory of the process so far.
+*/
+
+#include "synthiscript.h"
+
+#include "../iscript_fix/fixer.h"
+#include "../iscript_fix/instrument.h"
+#include "../iscript_fix/iscript.h"
+#include "../iscript_fix/log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+static size_t GetPeakMemoryKB()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS pmc;
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+	return pmc.PeakWorkingSetSize / 1024;
+#else
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	return (size_t)usage.ru_maxrss;  // Already KB on Linux
+#endif
+}
+
+static double Median(std::vector<double> v)
+{
+	std::sort(v.begin(), v.end());
+	return v[v.size() / 2];
+}
+
+static bool WriteFile(const std::string& fname, const std::vector<uint8_t>& data)
+{
+	std::ofstream os(fname, std::ofstream::binary);
+	os.write((const char*)data.data(), data.size());
+	return !os.fail();
+}
+
+int main(int argc, char* argv[])
+{
+	SynthParams base;
+	int repeats = 5;
+	unsigned decodeThreads = 1;
+	std::string workDir = ".";
+	for(int i = 1; i < argc; i++)
+	{
+		if(i + 1 == argc || argv[i][0] != '-')
+		{
+			printf("Usage : iscript_bench [-s seed] [-n repeats] [-p pointer density]\n");
+			printf("                      [-x sharing] [-v variable-length rate]\n");
+			printf("                      [-c min chunk opcodes] [-C max chunk opcodes]\n");
+			printf("                      [-t decode threads] [-w work dir]\n");
+			return -1;
+		}
+		const char* value = argv[++i];
+		switch(argv[i - 1][1])
+		{
+		case 's': base.seed = (uint32_t)strtoul(value, nullptr, 10); break;
+		case 'n': repeats = std::max(1, atoi(value)); break;
+		case 'p': base.pointerDensity = atof(value); break;
+		case 'x': base.sharing = atof(value); break;
+		case 'v': base.varLengthRate = atof(value); break;
+		case 'c': base.minChunkOpcodes = std::max(0, atoi(value)); break;
+		case 'C': base.maxChunkOpcodes = std::max(0, atoi(value)); break;
+		case 't': decodeThreads = (unsigned)std::max(1, atoi(value)); break;
+		case 'w': workDir = value; break;
+		default:
+			printf("[Error] Unknown option %s.\n", argv[i - 1]);
+			return -1;
+		}
+	}
+	if(base.maxChunkOpcodes < base.minChunkOpcodes) base.maxChunkOpcodes = base.minChunkOpcodes;
+
+	// Original the synthetic inputs get appended to. Small, so that every
+	// size up to the 64KB limit still fits after appending.
+	SynthParams origParams = base;
+	origParams.targetSize = 256;
+	origParams.firstEntryID = 0;
+	std::vector<uint8_t> origData = GenerateIScript(origParams, nullptr);
+	std::string logSink;
+	SetLogCapture(&logSink);
+	OriginalIScript orig(origData.data(), origData.size());
+	orig.Prepare(FixOptions());
+	SetLogCapture(nullptr);
+	logSink.clear();
+
+	const std::string inputName = workDir + "/bench_input.bin";
+	const std::string outputName = workDir + "/bench_output.bin";
+	const size_t sizes[] = { 4096, 8192, 16384, 32768, 49152, 65535 - 512 - 256 };
+
+	printf("%8s %7s %8s %7s | %9s %8s %8s %8s %8s | %9s %9s\n",
+		"size", "entries", "opcodes", "chunks",
+		"ctor ms", "MB/s", "dep ms", "alloc ms", "emit ms",
+		"model KB", "peak KB");
+
+	for(size_t size : sizes)
+	{
+		SynthParams params = base;
+		params.targetSize = size;
+		SynthStats stats;
+		std::vector<uint8_t> data = GenerateIScript(params, &stats);
+		if(!WriteFile(inputName, data))
+		{
+			printf("[Error] Cannot write %s.\n", inputName.c_str());
+			return -1;
+		}
+
+		std::vector<double> ctorMs, depMs, allocMs, emitMs;
+		size_t chunks = 0, modelBytes = 0;
+		SetLogCapture(&logSink);
+		for(int r = 0; r < repeats; r++)
+		{
+			double start = GetMonotonicMs();
+			IScript isc(data.data(), data.size(), false, decodeThreads);
+			ctorMs.push_back(GetMonotonicMs() - start);
+			chunks = isc.GetChunkCount();
+			modelBytes = isc.GetArenaBytes();
+
+			IScriptDependency isd;
+			std::vector<uint16_t> ids = isc.EnumEntries();
+			start = GetMonotonicMs();
+			for(uint16_t entryID : ids) isc.UpdateDependency(entryID, &isd);
+			depMs.push_back(GetMonotonicMs() - start);
+
+			Instrumentation inst;
+			SetInstrumentation(&inst);
+			bool ok = FixIScript(orig, inputName, outputName, FixOptions());
+			SetInstrumentation(nullptr);
+			if(!ok)
+			{
+				SetLogCapture(nullptr);
+				printf("%s[Error] Fixing %d byte input failed.\n", logSink.c_str(), (int)size);
+				return -1;
+			}
+			allocMs.push_back(inst.ms[PHASE_ALLOCATE] -
+				inst.ms[PHASE_DECODE] - inst.ms[PHASE_LINK] - inst.ms[PHASE_DEPENDENCY]);
+			emitMs.push_back(inst.ms[PHASE_EMIT]);
+			logSink.clear();
+		}
+		SetLogCapture(nullptr);
+
+		double ctor = Median(ctorMs);
+		printf("%8d %7d %8d %7d | %9.3f %8.1f %8.3f %8.3f %8.3f | %9d %9d\n",
+			(int)data.size(), (int)stats.entries, (int)stats.opcodes, (int)chunks,
+			ctor, ctor > 0 ? data.size() / 1048576.0 / (ctor / 1000.0) : 0.0,
+			Median(depMs), Median(allocMs), Median(emitMs),
+			(int)(modelBytes / 1024), (int)GetPeakMemoryKB());
+	}
+
+	remove(inputName.c_str());
+	remove(outputName.c_str());
+	return 0;
+}
@@ -0,0 +1,308 @@
+#include "synthiscript.h"
+
+#include "../iscript_fix/arena.h"
+#include "../iscript_fix/iscript.h"
+#include "../iscript_fix/iscript_opcode.h"
+
+#include <deque>
+#include <iterator>
+
+static const size_t NOT_EMITTED = (size_t)-1;
+
+namespace
+{
+	// splitmix64. Fixed algorithm, so output doesn't depend on the
+	// standard library.
+	class Rng
+	{
+	public:
+		explicit Rng(uint64_t seed) : _state(seed) {}
+
+		uint64_t Next()
+		{
+			uint64_t z = (_state += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		}
+
+		// Uniform in [0, n).
+		uint32_t Below(uint32_t n) { return (uint32_t)(Next() % n); }
+		bool Chance(double p) { return (Next() >> 11) * (1.0 / 9007199254740992.0) < p; }
+
+	private:
+		uint64_t _state;
+	};
+
+	struct OpcodeKind
+	{
+		uint8_t type;
+		uint8_t size;
+		uint8_t ptrPos;
+	};
+
+	// Where a pointer or slot leads : already emitted code, or a chunk
+	// still waiting to be emitted.
+	struct Ref
+	{
+		bool pending;
+		size_t value;  // Offset, or chunk index if pending
+	};
+
+	struct EntryPlan
+	{
+		uint16_t id;
+		uint32_t type;
+		std::vector<Ref> slots;  // value 0 & !pending for an empty slot
+	};
+
+	class Generator
+	{
+	public:
+		Generator(const SynthParams& params, SynthStats* stats);
+		std::vector<uint8_t> Run();
+
+	private:
+		void ProbeOpcodes();
+		Ref Point();
+		void WriteRef(size_t pos, const Ref& ref);
+		void EmitChunk(size_t chunk);
+		void DrainChunks();
+		bool CodeFull() const { return _out.size() >= _codeBudget; }
+		EntryPlan PlanEntry(uint16_t id, bool shareOnly);
+		size_t EntryBytes(const EntryPlan& entry) const { return 8 + entry.slots.size() * 2 + 4; }
+
+		const SynthParams& _params;
+		SynthStats* _stats;
+		Rng _rng;
+		size_t _codeBudget;
+
+		std::vector<OpcodeKind> _plain, _pointer;
+		std::vector<uint8_t> _out;
+		std::vector<size_t> _opcodeStarts;
+		std::vector<size_t> _chunkStart;  // NOT_EMITTED until emitted
+		std::deque<size_t> _pendingChunks;
+		std::vector<std::pair<size_t, size_t> > _patches;  // (pos, chunk)
+	};
+}
+
+Generator::Generator(const SynthParams& params, SynthStats* stats)
+	: _params(params), _stats(stats), _rng(params.seed)
+{
+	size_t targetSize = params.targetSize > 65535 ? 65535 : params.targetSize;
+	// Rest is left for headers & entry table.
+	_codeBudget = targetSize * 4 / 5;
+	ProbeOpcodes();
+}
+
+// Learn sizes & pointer positions from the decoder itself, so the
+// generator never disagrees with it.
+void Generator::ProbeOpcodes()
+{
+	Arena arena;
+	OpcodeTable table(&arena);
+	for(int type = 0; type <= 0x44; type++)
+	{
+		if(type == 0x19 || type == 0x1C || IsTerminator((uint8_t)type)) continue;
+		uint8_t probe[16] = { (uint8_t)type };
+		OpcodeHandle opc = GetOpcode(probe, sizeof(probe), 0, &table);
+		OpcodeKind kind = { (uint8_t)type, (uint8_t)table.size[opc], table.argOffset[opc] };
+		(kind.ptrPos ? _pointer : _plain).push_back(kind);
+	}
+}
+
+Ref Generator::Point()
+{
+	Ref ref;
+	if(!_opcodeStarts.empty() && (CodeFull() || _rng.Chance(_params.sharing)))
+	{
+		ref.pending = false;
+		ref.value = _opcodeStarts[_rng.Below((uint32_t)_opcodeStarts.size())];
+	}
+	else
+	{
+		ref.pending = true;
+		ref.value = _chunkStart.size();
+		_chunkStart.push_back(NOT_EMITTED);
+		_pendingChunks.push_back(ref.value);
+	}
+	return ref;
+}
+
+void Generator::WriteRef(size_t pos, const Ref& ref)
+{
+	if(ref.pending) _patches.push_back(std::make_pair(pos, ref.value));
+	else
+	{
+		_out[pos] = (uint8_t)ref.value;
+		_out[pos + 1] = (uint8_t)(ref.value >> 8);
+	}
+}
+
+void Generator::EmitChunk(size_t chunk)
+{
+	_chunkStart[chunk] = _out.size();
+
+	// Chunks asked for after code budget ran out are bare 'end's.
+	int opcodeCount = 0;
+	if(!CodeFull())
+	{
+		opcodeCount = _params.minChunkOpcodes +
+			_rng.Below(_params.maxChunkOpcodes - _params.minChunkOpcodes + 1);
+	}
+
+	for(int i = 0; i < opcodeCount; i++)
+	{
+		_opcodeStarts.push_back(_out.size());
+		_stats->opcodes++;
+		if(_rng.Chance(_params.varLengthRate))
+		{
+			uint8_t shortn = (uint8_t)(1 + _rng.Below(6));
+			_out.push_back(_rng.Chance(0.5) ? 0x19 : 0x1C);
+			_out.push_back(shortn);
+			for(int j = 0; j < shortn * 2; j++) _out.push_back((uint8_t)_rng.Next());
+			continue;
+		}
+
+		bool pointer = _rng.Chance(_params.pointerDensity);
+		const std::vector<OpcodeKind>& kinds = pointer ? _pointer : _plain;
+		const OpcodeKind& kind = kinds[_rng.Below((uint32_t)kinds.size())];
+		size_t pos = _out.size();
+		_out.push_back(kind.type);
+		for(int j = 1; j < kind.size; j++) _out.push_back((uint8_t)_rng.Next());
+		if(kind.ptrPos)
+		{
+			_stats->pointers++;
+			WriteRef(pos + kind.ptrPos, Point());
+		}
+	}
+
+	// Terminator : end, return or goto.
+	_opcodeStarts.push_back(_out.size());
+	_stats->opcodes++;
+	uint32_t terminator = CodeFull() ? 0 : _rng.Below(3);
+	if(terminator == 0) _out.push_back(0x16);
+	else if(terminator == 1) _out.push_back(0x36);
+	else
+	{
+		size_t pos = _out.size();
+		_out.push_back(0x07);
+		_out.push_back(0);
+		_out.push_back(0);
+		_stats->pointers++;
+		WriteRef(pos + 1, Point());
+	}
+}
+
+void Generator::DrainChunks()
+{
+	while(!_pendingChunks.empty())
+	{
+		size_t chunk = _pendingChunks.front();
+		_pendingChunks.pop_front();
+		EmitChunk(chunk);
+	}
+}
+
+EntryPlan Generator::PlanEntry(uint16_t id, bool shareOnly)
+{
+	EntryPlan entry;
+	entry.id = id;
+	auto it = entryType_opcodeNum_map.begin();
+	std::advance(it, _rng.Below((uint32_t)entryType_opcodeNum_map.size()));
+	entry.type = it->first;
+	for(uint32_t i = 0; i < it->second; i++)
+	{
+		Ref ref = { false, 0 };
+		if(!_rng.Chance(_params.emptySlotRate))
+		{
+			if(shareOnly)
+			{
+				if(!_opcodeStarts.empty())
+				{
+					ref.value = _opcodeStarts[_rng.Below((uint32_t)_opcodeStarts.size())];
+				}
+			}
+			else ref = Point();
+		}
+		entry.slots.push_back(ref);
+	}
+	return entry;
+}
+
+std::vector<uint8_t> Generator::Run()
+{
+	_stats->entries = _stats->opcodes = _stats->pointers = 0;
+	size_t targetSize = _params.targetSize > 65535 ? 65535 : _params.targetSize;
+
+	_out.assign(2, 0);  // Entry table offset, written last
+	std::vector<EntryPlan> entries;
+	size_t entryBytes = 4;  // Table terminator
+	uint32_t nextID = _params.firstEntryID;
+
+	// Entries bringing code of their own, until code budget runs out.
+	// Largest header plus table row is kept free, for short chunks.
+	const size_t maxEntryBytes = 8 + 2 * 32 + 4;
+	while(!CodeFull() && nextID < 0xFFFF &&
+		_out.size() + entryBytes + maxEntryBytes <= targetSize)
+	{
+		entries.push_back(PlanEntry((uint16_t)nextID++, false));
+		entryBytes += EntryBytes(entries.back());
+		DrainChunks();
+	}
+
+	// Entries sharing existing code fill the rest.
+	while(nextID < 0xFFFF)
+	{
+		EntryPlan entry = PlanEntry((uint16_t)nextID, true);
+		if(_out.size() + entryBytes + EntryBytes(entry) > targetSize) break;
+		nextID++;
+		entryBytes += EntryBytes(entry);
+		entries.push_back(entry);
+	}
+
+	for(auto& patch : _patches)
+	{
+		size_t offset = _chunkStart[patch.second];
+		_out[patch.first] = (uint8_t)offset;
+		_out[patch.first + 1] = (uint8_t)(offset >> 8);
+	}
+
+	std::vector<size_t> headerOffsets;
+	for(const EntryPlan& entry : entries)
+	{
+		headerOffsets.push_back(_out.size());
+		const char* magic = "SCPE";
+		_out.insert(_out.end(), magic, magic + 4);
+		for(int i = 0; i < 4; i++) _out.push_back((uint8_t)(entry.type >> (i * 8)));
+		for(const Ref& ref : entry.slots)
+		{
+			size_t offset = ref.pending ? _chunkStart[ref.value] : ref.value;
+			_out.push_back((uint8_t)offset);
+			_out.push_back((uint8_t)(offset >> 8));
+		}
+	}
+
+	size_t tableOffset = _out.size();
+	_out[0] = (uint8_t)tableOffset;
+	_out[1] = (uint8_t)(tableOffset >> 8);
+	for(size_t i = 0; i < entries.size(); i++)
+	{
+		_out.push_back((uint8_t)entries[i].id);
+		_out.push_back((uint8_t)(entries[i].id >> 8));
+		_out.push_back((uint8_t)headerOffsets[i]);
+		_out.push_back((uint8_t)(headerOffsets[i] >> 8));
+	}
+	const uint8_t tableEnd[4] = { 0xFF, 0xFF, 0x00, 0x00 };
+	_out.insert(_out.end(), tableEnd, tableEnd + 4);
+
+	_stats->entries = entries.size();
+	return _out;
+}
+
+std::vector<uint8_t> GenerateIScript(const SynthParams& params, SynthStats* stats)
+{
+	SynthStats localStats;
+	Generator generator(params, stats ? stats : &localStats);
+	return generator.Run();
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#ifndef SYNTHISCRIPT_HEADER_
+#define SYNTHISCRIPT_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+Generator of valid synthetic iscripts. Same parameters give the same
+bytes on every platform.
+
+Entries are added until the file reaches targetSize. Each slot either
+stays empty, points into code generated so far (sharing), or starts a new
+chunk. A chunk is a run of random opcodes ending in end, return or goto.
+Pointer opcodes met on the way target existing code with probability
+sharing, and spawn new chunks otherwise. Once code fills its share of
+targetSize, every new pointer shares, so generation always stops.
+*/
+
+struct SynthParams
+{
+	SynthParams() :
+		seed(1), targetSize(32768), firstEntryID(1000),
+		minChunkOpcodes(2), maxChunkOpcodes(12),
+		pointerDensity(0.1), sharing(0.5), varLengthRate(0.02),
+		emptySlotRate(0.2) {}
+
+	uint32_t seed;
+	size_t targetSize;  // At most 65535
+	uint16_t firstEntryID;  // Entries get consecutive IDs from here
+	int minChunkOpcodes;  // Terminator not included
+	int maxChunkOpcodes;
+	double pointerDensity;  // Chance an opcode carries a pointer
+	double sharing;  // Chance a pointer or slot reuses existing code
+	double varLengthRate;  // Chance of variable-length 0x19 / 0x1C
+	double emptySlotRate;
+};
+
+struct SynthStats
+{
+	size_t entries;
+	size_t opcodes;
+	size_t pointers;
+};
+
+std::vector<uint8_t> GenerateIScript(const SynthParams& params, SynthStats* stats);
+
+#endif
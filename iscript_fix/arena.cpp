@@ -0,0 +1,65 @@
+#include "arena.h"
+
+#include <cstdlib>
+#include <cstdint>
+
+Arena::Arena(size_t blockSize)
+	: _head(nullptr), _cur(nullptr), _end(nullptr),
+	_blockSize(blockSize), _reserved(0), _blocks(0)
+{
+}
+
+Arena::~Arena()
+{
+	Release();
+}
+
+void* Arena::Allocate(size_t size, size_t align)
+{
+	// Big requests get a block of their own, so the current block stays open.
+	if(size > _blockSize / 4)
+	{
+		Block* block = (Block*)malloc(sizeof(Block) + size + align);
+		if(block == nullptr) throw std::bad_alloc();
+		block->prev = _head;
+		block->size = sizeof(Block) + size + align;
+		_head = block;
+		_reserved += block->size;
+		_blocks++;
+
+		uintptr_t p = (uintptr_t)(block + 1);
+		return (void*)((p + align - 1) & ~(uintptr_t)(align - 1));
+	}
+
+	uintptr_t p = ((uintptr_t)_cur + align - 1) & ~(uintptr_t)(align - 1);
+	if(_cur == nullptr || p + size > (uintptr_t)_end)
+	{
+		Block* block = (Block*)malloc(_blockSize);
+		if(block == nullptr) throw std::bad_alloc();
+		block->prev = _head;
+		block->size = _blockSize;
+		_head = block;
+		_reserved += _blockSize;
+		_blocks++;
+
+		_cur = (char*)(block + 1);
+		_end = (char*)block + _blockSize;
+		p = ((uintptr_t)_cur + align - 1) & ~(uintptr_t)(align - 1);
+	}
+
+	_cur = (char*)(p + size);
+	return (void*)p;
+}
+
+void Arena::Release()
+{
+	while(_head)
+	{
+		Block* prev = _head->prev;
+		free(_head);
+		_head = prev;
+	}
+	_cur = _end = nullptr;
+	_reserved = 0;
+	_blocks = 0;
+}
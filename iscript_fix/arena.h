@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef ARENA_HEADER_
+#define ARENA_HEADER_
+
+#include <cstddef>
+#include <map>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+Monotonic arena. Allocation bumps a pointer inside the current block and
+individual frees are no-ops. All blocks are given back at once when the
+arena is released or destroyed.
+
+IScript owns one arena for its decoded model, so dropping an IScript
+returns everything it decoded without walking the model.
+*/
+
+class Arena
+{
+public:
+	explicit Arena(size_t blockSize = 64 * 1024);
+	~Arena();
+
+	void* Allocate(size_t size, size_t align);
+	void Release();
+
+	size_t GetBytesReserved() const { return _reserved; }
+	size_t GetBlockCount() const { return _blocks; }
+
+private:
+	Arena(const Arena&);
+	Arena& operator=(const Arena&);
+
+	struct Block
+	{
+		Block* prev;
+		size_t size;
+	};
+
+	Block* _head;
+	char* _cur;
+	char* _end;
+	size_t _blockSize;
+	size_t _reserved;
+	size_t _blocks;
+};
+
+// Standard allocator drawing from an Arena. deallocate does nothing.
+template<typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	template<typename U> struct rebind { typedef ArenaAllocator<U> other; };
+
+	explicit ArenaAllocator(Arena* arena) : _arena(arena) {}
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& rhs) : _arena(rhs.GetArena()) {}
+
+	T* allocate(size_t n)
+	{
+		return (T*)_arena->Allocate(n * sizeof(T), std::alignment_of<T>::value);
+	}
+	void deallocate(T*, size_t) {}
+
+	template<typename U, typename... Args>
+	void construct(U* p, Args&&... args)
+	{
+		::new((void*)p) U(std::forward<Args>(args)...);
+	}
+	template<typename U> void destroy(U* p) { p->~U(); }
+
+	size_t max_size() const { return ((size_t)-1) / sizeof(T); }
+
+	Arena* GetArena() const { return _arena; }
+
+private:
+	Arena* _arena;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+	return a.GetArena() == b.GetArena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+	return a.GetArena() != b.GetArena();
+}
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T> >;
+
+template<typename K, typename V>
+using ArenaMap = std::map<K, V, std::less<K>, ArenaAllocator<std::pair<const K, V> > >;
+
+#endif
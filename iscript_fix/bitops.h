@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef BITOPS_HEADER_
+#define BITOPS_HEADER_
+
+#include <cstdint>
+
+inline uint32_t Popcount64(uint64_t x)
+{
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+}
+
+// Index of lowest set bit. x should not be 0.
+inline uint32_t LowestBit64(uint64_t x)
+{
+	return Popcount64((x & (0 - x)) - 1);
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include "chunkgraph.h"
+
+#include <algorithm>
+#include <stack>
+#include <utility>
+
+static const uint32_t UNVISITED = 0xFFFFFFFF;
+
+ChunkGraph::ChunkGraph() : _chunkCount(0)
+{
+}
+
+void ChunkGraph::Build(
+	const OpcodeTable& opcodes,
+	const OpcodeChunk* chunks,
+	size_t chunkCount)
+{
+	_chunkCount = chunkCount;
+
+	// Collect chunk edges.
+	_edgeBegin.assign(1, 0);
+	_edges.clear();
+	for(size_t chkID = 0; chkID < chunkCount; chkID++)
+	{
+		const OpcodeChunk& chk = chunks[chkID];
+		size_t edgeStart = _edges.size();
+		for(OpcodeHandle opc = chk.first; opc < chk.first + chk.count; opc++)
+		{
+			OpcodeHandle target = opcodes.target[opc];
+			if(target != NO_OPCODE) _edges.push_back(opcodes.chunk[target]);
+		}
+		std::sort(_edges.begin() + edgeStart, _edges.end());
+		_edges.erase(
+			std::unique(_edges.begin() + edgeStart, _edges.end()),
+			_edges.end());
+		_edgeBegin.push_back(_edges.size());
+	}
+
+	FindComponents();
+
+	// Condensed edges between components.
+	size_t compn = _componentChunkBegin.size() - 1;
+	_componentEdgeBegin.assign(1, 0);
+	_componentEdges.clear();
+	_componentCyclic.assign(compn, false);
+	for(uint32_t comp = 0; comp < compn; comp++)
+	{
+		size_t edgeStart = _componentEdges.size();
+		if(_componentChunkBegin[comp + 1] - _componentChunkBegin[comp] > 1)
+		{
+			_componentCyclic[comp] = true;
+		}
+		for(uint32_t i = _componentChunkBegin[comp]; i < _componentChunkBegin[comp + 1]; i++)
+		{
+			uint32_t chkID = _componentChunks[i];
+			for(uint32_t e = _edgeBegin[chkID]; e < _edgeBegin[chkID + 1]; e++)
+			{
+				uint32_t targetComp = _chunkComponent[_edges[e]];
+				if(targetComp != comp) _componentEdges.push_back(targetComp);
+				else _componentCyclic[comp] = true;
+			}
+		}
+		std::sort(_componentEdges.begin() + edgeStart, _componentEdges.end());
+		_componentEdges.erase(
+			std::unique(_componentEdges.begin() + edgeStart, _componentEdges.end()),
+			_componentEdges.end());
+		_componentEdgeBegin.push_back(_componentEdges.size());
+	}
+
+	_componentReach.assign(compn, ChunkSet());
+	_componentReachDone.assign(compn, false);
+}
+
+/*
+Iterative Tarjan's algorithm. A component is completed only after every
+component it reaches, so component IDs come out in reverse topological
+order.
+*/
+void ChunkGraph::FindComponents()
+{
+	std::vector<uint32_t> index(_chunkCount, UNVISITED);
+	std::vector<uint32_t> lowlink(_chunkCount);
+	std::vector<bool> onStack(_chunkCount, false);
+	std::vector<uint32_t> sccStack;
+	std::stack<std::pair<uint32_t, uint32_t> > callStack;  // chunk, next edge
+	uint32_t nextIndex = 0;
+
+	_chunkComponent.assign(_chunkCount, UNVISITED);
+	_componentChunkBegin.assign(1, 0);
+	_componentChunks.clear();
+
+	for(uint32_t root = 0; root < _chunkCount; root++)
+	{
+		if(index[root] != UNVISITED) continue;
+		callStack.push(std::make_pair(root, _edgeBegin[root]));
+		index[root] = lowlink[root] = nextIndex++;
+		sccStack.push_back(root);
+		onStack[root] = true;
+
+		while(!callStack.empty())
+		{
+			uint32_t v = callStack.top().first;
+			uint32_t& e = callStack.top().second;
+
+			if(e < _edgeBegin[v + 1])
+			{
+				uint32_t w = _edges[e++];
+				if(index[w] == UNVISITED)
+				{
+					index[w] = lowlink[w] = nextIndex++;
+					sccStack.push_back(w);
+					onStack[w] = true;
+					callStack.push(std::make_pair(w, _edgeBegin[w]));
+				}
+				else if(onStack[w])
+				{
+					lowlink[v] = std::min(lowlink[v], index[w]);
+				}
+				continue;
+			}
+
+			// v is done.
+			callStack.pop();
+			if(lowlink[v] == index[v])
+			{
+				uint32_t comp = _componentChunkBegin.size() - 1;
+				uint32_t w;
+				do
+				{
+					w = sccStack.back();
+					sccStack.pop_back();
+					onStack[w] = false;
+					_chunkComponent[w] = comp;
+					_componentChunks.push_back(w);
+				} while(w != v);
+				_componentChunkBegin.push_back(_componentChunks.size());
+			}
+			if(!callStack.empty())
+			{
+				uint32_t parent = callStack.top().first;
+				lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+			}
+		}
+	}
+}
+
+void ChunkGraph::ComputeReachable(uint32_t component)
+{
+	// Post-order over the condensed DAG, so successors are done first.
+	std::stack<std::pair<uint32_t, uint32_t> > callStack;  // comp, next edge
+	callStack.push(std::make_pair(component, _componentEdgeBegin[component]));
+
+	while(!callStack.empty())
+	{
+		uint32_t comp = callStack.top().first;
+		uint32_t& e = callStack.top().second;
+
+		if(e < _componentEdgeBegin[comp + 1])
+		{
+			uint32_t succ = _componentEdges[e++];
+			if(!_componentReachDone[succ])
+			{
+				callStack.push(std::make_pair(succ, _componentEdgeBegin[succ]));
+			}
+			continue;
+		}
+
+		callStack.pop();
+		if(_componentReachDone[comp]) continue;
+
+		ChunkSet& reach = _componentReach[comp];
+		reach = ChunkSet(_chunkCount);
+		for(uint32_t i = _componentChunkBegin[comp]; i < _componentChunkBegin[comp + 1]; i++)
+		{
+			reach.Set(_componentChunks[i]);
+		}
+		for(uint32_t i = _componentEdgeBegin[comp]; i < _componentEdgeBegin[comp + 1]; i++)
+		{
+			reach |= _componentReach[_componentEdges[i]];
+		}
+		_componentReachDone[comp] = true;
+	}
+}
+
+const ChunkSet& ChunkGraph::GetReachable(uint32_t chkID)
+{
+	uint32_t comp = _chunkComponent[chkID];
+	if(!_componentReachDone[comp]) ComputeReachable(comp);
+	return _componentReach[comp];
+}
+
+const uint32_t* ChunkGraph::GetComponentChunks(uint32_t comp, uint32_t* count) const
+{
+	*count = _componentChunkBegin[comp + 1] - _componentChunkBegin[comp];
+	return _componentChunks.data() + _componentChunkBegin[comp];
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef CHUNKGRAPH_HEADER_
+#define CHUNKGRAPH_HEADER_
+
+#include <cstdint>
+#include <vector>
+
+#include "iscript_opcode.h"
+#include "chunkset.h"
+
+/*
+Chunk-level dependency graph. Chunk A depends on chunk B when some opcode
+of A points into B.
+
+Strongly connected components are condensed, so every chunk of a loop
+shares one memoized set of reachable chunks. Reachable set of a component
+is its own chunks plus sets of its successors, computed once on demand.
+*/
+
+class ChunkGraph
+{
+public:
+	ChunkGraph();
+
+	void Build(
+		const OpcodeTable& opcodes,
+		const OpcodeChunk* chunks,
+		size_t chunkCount);
+
+	// Chunks reachable from chkID, including itself.
+	const ChunkSet& GetReachable(uint32_t chkID);
+
+	size_t GetComponentCount() const { return _componentReachDone.size(); }
+	uint32_t GetComponent(uint32_t chkID) const { return _chunkComponent[chkID]; }
+	// Chunks of a component, count of them stored to count.
+	const uint32_t* GetComponentChunks(uint32_t comp, uint32_t* count) const;
+	// Component is a loop : more than one chunk, or a chunk pointing into itself.
+	bool IsCyclic(uint32_t comp) const { return _componentCyclic[comp]; }
+
+private:
+	void FindComponents();
+	void ComputeReachable(uint32_t component);
+
+	size_t _chunkCount;
+
+	// Chunk edges, compressed sparse rows.
+	std::vector<uint32_t> _edgeBegin;
+	std::vector<uint32_t> _edges;
+
+	// Condensed graph. Components are numbered in reverse topological order.
+	std::vector<uint32_t> _chunkComponent;
+	std::vector<uint32_t> _componentChunkBegin;
+	std::vector<uint32_t> _componentChunks;
+	std::vector<uint32_t> _componentEdgeBegin;
+	std::vector<uint32_t> _componentEdges;
+	std::vector<bool> _componentCyclic;
+
+	std::vector<ChunkSet> _componentReach;
+	std::vector<bool> _componentReachDone;
+};
+
+#endif
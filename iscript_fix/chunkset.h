@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef CHUNKSET_HEADER_
+#define CHUNKSET_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bitops.h"
+
+/*
+Set of chunk IDs as a bitset. Union of two sets is a word-wise OR, and
+iteration visits chunk IDs in ascending order.
+*/
+
+class ChunkSet
+{
+public:
+	ChunkSet() {}
+	explicit ChunkSet(size_t chunkCount) : _words((chunkCount + 63) / 64) {}
+
+	bool Test(uint32_t chkID) const
+	{
+		return (chkID >> 6) < _words.size() &&
+			((_words[chkID >> 6] >> (chkID & 63)) & 1);
+	}
+
+	void Set(uint32_t chkID)
+	{
+		if((chkID >> 6) >= _words.size()) _words.resize((chkID >> 6) + 1);
+		_words[chkID >> 6] |= (uint64_t)1 << (chkID & 63);
+	}
+
+	void Clear() { _words.clear(); }
+
+	ChunkSet& operator|=(const ChunkSet& rhs)
+	{
+		if(rhs._words.size() > _words.size()) _words.resize(rhs._words.size());
+		for(size_t i = 0; i < rhs._words.size(); i++) _words[i] |= rhs._words[i];
+		return *this;
+	}
+
+	size_t Count() const
+	{
+		size_t n = 0;
+		for(uint64_t w : _words) n += Popcount64(w);
+		return n;
+	}
+
+	// Call f(chkID) for every chunk in the set, in ascending order.
+	template<typename F> void ForEach(F f) const
+	{
+		for(size_t i = 0; i < _words.size(); i++)
+		{
+			uint64_t w = _words[i];
+			while(w)
+			{
+				f((uint32_t)(i * 64 + LowestBit64(w)));
+				w &= w - 1;
+			}
+		}
+	}
+
+	// Raw bit words, chunk i at bit i % 64 of word i / 64. For saving
+	// sets to a file & loading them back.
+	const std::vector<uint64_t>& GetWords() const { return _words; }
+	void SetWords(const uint64_t* words, size_t count)
+	{
+		_words.assign(words, words + count);
+	}
+
+private:
+	std::vector<uint64_t> _words;
+};
+
+#endif
@@ -0,0 +1,204 @@
+#include "dedup.h"
+#include "iscript.h"
+#include "structhash.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Hash runs of chunk from each opcode to its end. Hash of whole chunk is
+// returned, and every run's hash goes to runHashes if given.
+static uint64_t HashRuns(
+	const IScript& isc,
+	const OpcodeChunk& chk,
+	std::vector<uint64_t>* runHashes)
+{
+	const OpcodeTable& opcodes = isc.GetOpcodes();
+	if(runHashes) runHashes->resize(chk.count);
+
+	uint64_t h = 0;
+	for(uint32_t i = chk.count; i-- > 0;)
+	{
+		OpcodeHandle opc = chk.first + i;
+		h = HashMix(h, HashOpcodeBytes(
+			isc.GetOpcodeData(opc),
+			opcodes.size[opc],
+			opcodes.argOffset[opc]));
+		if(runHashes) (*runHashes)[i] = h;
+	}
+	return h;
+}
+
+ChunkIndex::ChunkIndex() : _data(nullptr), _dataend(0)
+{
+}
+
+void ChunkIndex::Build(const IScript& isc, const uint8_t* data, uint16_t dataend)
+{
+	_data = data;
+	_dataend = dataend;
+	_runs.clear();
+
+	const OpcodeTable& opcodes = isc.GetOpcodes();
+	std::vector<uint64_t> runHashes;
+	for(size_t chkID = 0; chkID < isc.GetChunkCount(); chkID++)
+	{
+		const OpcodeChunk& chk = isc.GetChunk(chkID);
+		HashRuns(isc, chk, &runHashes);
+		for(uint32_t i = 0; i < chk.count; i++)
+		{
+			uint16_t offset = opcodes.offset[chk.first + i];
+			if(offset < dataend) _runs.insert(std::make_pair(runHashes[i], offset));
+		}
+	}
+}
+
+struct ChunkDedup
+{
+	struct Alias
+	{
+		uint32_t chkID;
+		uint16_t offset;
+		bool valid;
+	};
+
+	ChunkDedup(IScript& userisc, const ChunkIndex& index)
+		: userisc(userisc), opcodes(userisc.GetOpcodes()), index(index) {}
+
+	// Offsets of original runs with the same hash as chk.
+	template<typename F>
+	void ForEachCandidate(const OpcodeChunk& chk, F f) const
+	{
+		auto range = index._runs.equal_range(HashRuns(userisc, chk, nullptr));
+		for(auto it = range.first; it != range.second; ++it) f(it->second);
+	}
+
+	// Same bytes at offset of original iscript, except for pointers.
+	bool CodeMatches(const OpcodeChunk& chk, uint16_t offset) const
+	{
+		if(offset + chk.size > index._dataend) return false;
+		for(OpcodeHandle opc = chk.first; opc < chk.first + chk.count; opc++)
+		{
+			const uint8_t* user = userisc.GetOpcodeData(opc);
+			const uint8_t* orig = index._data + offset + opcodes.chunkPos[opc];
+			uint8_t ptrPos = opcodes.argOffset[opc];
+			for(uint16_t i = 0; i < opcodes.size[opc]; i++)
+			{
+				if(ptrPos && (i == ptrPos || i == ptrPos + 1)) continue;
+				if(user[i] != orig[i]) return false;
+			}
+		}
+		return true;
+	}
+
+	// Check pointers of alias. isAliased(chkID, offset) tells whether chunk
+	// chkID currently sits at offset of original iscript.
+	template<typename F>
+	bool PointersAgree(const Alias& alias, F isAliased) const
+	{
+		const OpcodeChunk& chk = userisc.GetChunk(alias.chkID);
+		for(OpcodeHandle opc = chk.first; opc < chk.first + chk.count; opc++)
+		{
+			OpcodeHandle target = opcodes.target[opc];
+			if(target == NO_OPCODE) continue;
+
+			uint16_t origTarget;
+			memcpy(&origTarget,
+				index._data + alias.offset + opcodes.chunkPos[opc] + opcodes.argOffset[opc],
+				2);
+			uint16_t targetPos = opcodes.chunkPos[target];
+			if(origTarget < targetPos) return false;
+			if(!isAliased(opcodes.chunk[target], origTarget - targetPos)) return false;
+		}
+		return true;
+	}
+
+	IScript& userisc;
+	const OpcodeTable& opcodes;
+	const ChunkIndex& index;
+};
+
+ChunkSet DedupChunks(
+	IScript& userisc,
+	const ChunkSet& chunks,
+	const ChunkIndex& index)
+{
+	ChunkSet aliased;
+	if(index.IsEmpty()) return aliased;
+
+	ChunkDedup dedup(userisc, index);
+	std::vector<ChunkDedup::Alias> aliases;
+	std::map<std::pair<uint32_t, uint16_t>, size_t> aliasIndex;
+
+	// Candidates, by hash and then byte by byte.
+	chunks.ForEach([&](uint32_t chkID)
+	{
+		const OpcodeChunk& chk = userisc.GetChunk(chkID);
+		dedup.ForEachCandidate(chk, [&](uint16_t offset)
+		{
+			if(!dedup.CodeMatches(chk, offset)) return;
+			ChunkDedup::Alias alias = { chkID, offset, true };
+			aliasIndex[std::make_pair(chkID, offset)] = aliases.size();
+			aliases.push_back(alias);
+		});
+	});
+
+	// Drop candidates whose pointers disagree until none do. Starting from
+	// every candidate and only dropping gives the largest consistent set.
+	auto isCandidate = [&](uint32_t chkID, uint16_t offset)
+	{
+		auto it = aliasIndex.find(std::make_pair(chkID, offset));
+		return it != aliasIndex.end() && aliases[it->second].valid;
+	};
+	bool changed = true;
+	while(changed)
+	{
+		changed = false;
+		for(ChunkDedup::Alias& alias : aliases)
+		{
+			if(alias.valid && !dedup.PointersAgree(alias, isCandidate))
+			{
+				alias.valid = false;
+				changed = true;
+			}
+		}
+	}
+
+	// A chunk may still have several candidates, so pick the first one
+	// and drop picks whose pointers relied on another candidate.
+	std::map<uint32_t, uint16_t> picked;
+	for(const ChunkDedup::Alias& alias : aliases)
+	{
+		if(alias.valid && !picked.count(alias.chkID))
+		{
+			picked[alias.chkID] = alias.offset;
+		}
+	}
+	auto isPicked = [&](uint32_t chkID, uint16_t offset)
+	{
+		auto it = picked.find(chkID);
+		return it != picked.end() && it->second == offset;
+	};
+	changed = true;
+	while(changed)
+	{
+		changed = false;
+		for(auto it = picked.begin(); it != picked.end();)
+		{
+			ChunkDedup::Alias alias = { it->first, it->second, true };
+			if(!dedup.PointersAgree(alias, isPicked))
+			{
+				it = picked.erase(it);
+				changed = true;
+			}
+			else ++it;
+		}
+	}
+
+	for(auto& pick : picked)
+	{
+		userisc.GetChunk(pick.first).allocated_offset = pick.second;
+		aliased.Set(pick.first);
+	}
+	return aliased;
+}
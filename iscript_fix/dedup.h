@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef DEDUP_HEADER_
+#define DEDUP_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+#include "chunkset.h"
+
+class IScript;
+
+/*
+Index of code in original iscript, for reusing it instead of emitting
+copies of user chunks.
+
+Every opcode run from some opcode to the terminator ending its chunk is
+hashed with pointer values left out, so a user chunk with the same code
+hashes the same no matter where it sits. User chunks may then match a
+whole original chunk or any tail of one.
+*/
+class ChunkIndex
+{
+public:
+	ChunkIndex();
+
+	// isc should be decoded from data. Only code before dataend is used.
+	void Build(const IScript& isc, const uint8_t* data, uint16_t dataend);
+
+	bool IsEmpty() const { return _runs.empty(); }
+
+private:
+	friend struct ChunkDedup;
+
+	const uint8_t* _data;
+	uint16_t _dataend;
+	std::multimap<uint64_t, uint16_t> _runs;  // Hash -> offset of run.
+};
+
+/*
+Find chunks of userisc that original code at some offset can stand in for,
+and point their allocated_offset there. Returns set of those chunks : they
+need no bytes of their own.
+
+Beside having the same bytes, pointers must agree : every pointer of an
+aliased chunk has to target a chunk aliased to exactly where the original
+code points. The largest set of aliases satisfying that is kept, so loops
+of chunks can be aliased together.
+*/
+ChunkSet DedupChunks(
+	IScript& userisc,
+	const ChunkSet& chunks,
+	const ChunkIndex& index);
+
+#endif
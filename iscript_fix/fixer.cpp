@@ -0,0 +1,685 @@
+#include "fixer.h"
+#include "instrument.h"
+#include "iscript.h"
+#include "log.h"
+#include "layout.h"
+#include "mappedfile.h"
+#include "origmodel.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include <new>
+#include <string>
+#include <vector>
+#include <set>
+
+#include <algorithm>
+#include <iterator>
+
+OriginalIScript::OriginalIScript()
+	: OriginalIScript(origIScriptData, origIScriptSize)
+{
+}
+
+OriginalIScript::OriginalIScript(const uint8_t* data, size_t size)
+	: data(data), size(size), ids(nullptr), idCount(0)
+{
+	// Only entry IDs of original iscript are needed, so nothing gets decoded.
+	if(size < 2) FatalError("Original iscript is too small.");
+	memcpy(&dataend, data, 2);
+	ReadEntryTable();
+}
+
+/*
+Entry table may be followed by anything and may repeat an ID, so it is
+walked to its terminator instead of assumed to end the file. Repeated
+IDs keep their first row, as in IScript.
+*/
+void OriginalIScript::ReadEntryTable()
+{
+	std::set<uint16_t> seen;
+	for(size_t row = dataend; ; row += 4)
+	{
+		uint16_t entryID = 0xFFFF;
+		if(row + 2 <= size) memcpy(&entryID, data + row, 2);
+		if(row + 2 > size || (entryID != 0xFFFF && row + 4 > size))
+		{
+			FatalError("Entry table of original iscript is truncated.");
+		}
+		if(entryID == 0xFFFF) break;
+		if(!seen.insert(entryID).second) continue;
+		_tableStorage.insert(_tableStorage.end(), data + row, data + row + 4);
+	}
+	table = _tableStorage.data();
+	_idStorage.assign(seen.begin(), seen.end());
+	ids = _idStorage.data();
+	idCount = _idStorage.size();
+}
+
+OriginalIScript::~OriginalIScript()
+{
+}
+
+void OriginalIScript::Prepare(const FixOptions& options, const std::string& modelFile)
+{
+	if(!options.contentDiff && !options.dedup &&
+		!options.fillGaps && !options.compact) return;
+
+	if(modelFile.empty()) model.reset(new IScript(data, size));
+	else
+	{
+		// Same chunks as an eager decode, whether loaded or decoded here.
+		model.reset(new IScript(data, size, true));
+		MappedFile modelData(modelFile);
+		if(!modelData.IsOpen() || !model->LoadModel(modelData.data(), modelData.size()))
+		{
+			if(!model->SaveModel(modelFile))
+			{
+				Log("[Warning] Cannot save original model to %s.\n", modelFile.c_str());
+			}
+		}
+	}
+	IScript& origisc = *model;
+	if(options.contentDiff)
+	{
+		for(size_t i = 0; i < idCount; i++)
+		{
+			entryHashes[ids[i]] = origisc.GetEntryHash(ids[i]);
+		}
+	}
+	if(options.dedup) chunkIndex.Build(origisc, data, dataend);
+	if(options.fillGaps || options.compact)
+	{
+		for(size_t row = dataend; row + 4 <= size; row += 4)
+		{
+			uint16_t entryID, entryOffset;
+			memcpy(&entryID, data + row, 2);
+			memcpy(&entryOffset, data + row + 2, 2);
+			if(entryID == 0xFFFF) break;
+			if(entryUsage.count(entryID)) continue;  // First row wins, as in IScript
+
+			const IScriptEntry* entry = origisc.GetEntry(entryID);
+			EntryUsage& usage = entryUsage[entryID];
+			usage.headerOffset = entryOffset;
+			usage.headerSize = 8 + entry->count * 2;
+			usage.chunks = origisc.GetEntryDependency(entryID);
+		}
+		for(size_t chkID = 0; chkID < origisc.GetChunkCount(); chkID++)
+		{
+			const OpcodeChunk& chk = origisc.GetChunk(chkID);
+			CodeGap range = { origisc.GetOpcodes().offset[chk.first], chk.size };
+			chunkRanges.push_back(range);
+		}
+	}
+}
+
+/*
+Parts of original data nothing in the output uses anymore. That is what
+original entries never reached, plus what only overridden entries did.
+Code user chunks got aliased to stays.
+*/
+static std::vector<CodeGap> FindOriginalGaps(
+	const OriginalIScript& orig,
+	const std::set<uint16_t>& overridden,
+	const IScript& userisc,
+	const ChunkSet& aliased)
+{
+	std::vector<bool> used(orig.dataend, false);
+	auto markUsed = [&](uint32_t offset, uint32_t size)
+	{
+		for(uint32_t i = offset; i < offset + size && i < orig.dataend; i++)
+		{
+			used[i] = true;
+		}
+	};
+
+	markUsed(0, 2);  // Entry table offset
+	ChunkSet usedChunks;
+	for(auto& it : orig.entryUsage)
+	{
+		if(overridden.count(it.first)) continue;
+		markUsed(it.second.headerOffset, it.second.headerSize);
+		usedChunks |= it.second.chunks;
+	}
+	usedChunks.ForEach([&](uint32_t chkID)
+	{
+		markUsed(orig.chunkRanges[chkID].offset, orig.chunkRanges[chkID].size);
+	});
+	aliased.ForEach([&](uint32_t chkID)
+	{
+		const OpcodeChunk& chk = userisc.GetChunk(chkID);
+		markUsed(chk.allocated_offset, chk.size);
+	});
+
+	std::vector<CodeGap> gaps;
+	for(uint32_t i = 0; i < orig.dataend;)
+	{
+		if(used[i]) { i++; continue; }
+		CodeGap gap = { i, 0 };
+		while(i < orig.dataend && !used[i]) { gap.size++; i++; }
+		gaps.push_back(gap);
+	}
+	return gaps;
+}
+
+/*
+Copy opcodes of every piece in layout to where it was placed. Bytes of a
+piece are contiguous in isc, so copy them at once and then patch pointers.
+*/
+static void WritePieces(
+	uint8_t* datastart,
+	const IScript& isc,
+	const CodeLayout& layout)
+{
+	const OpcodeTable& opcodes = isc.GetOpcodes();
+	for(const CodePiece& piece : layout.GetPieces())
+	{
+		uint8_t* datacur = datastart + piece.offset;
+		OpcodeHandle last = piece.first + piece.count - 1;
+		uint16_t firstPos = opcodes.chunkPos[piece.first];
+		uint32_t runSize = opcodes.chunkPos[last] + opcodes.size[last] - firstPos;
+		memcpy(datacur, isc.GetOpcodeData(piece.first), runSize);
+		for(OpcodeHandle opc = piece.first; opc <= last; opc++)
+		{
+			OpcodeHandle pointee = layout.GetTarget(opc);
+			if(pointee != NO_OPCODE)
+			{
+				uint16_t pointee_offset = layout.GetOffset(pointee);
+				memcpy(
+					datacur + opcodes.chunkPos[opc] - firstPos + opcodes.argOffset[opc],
+					&pointee_offset,
+					2
+					);
+			}
+		}
+		datacur += runSize;
+
+		if(piece.gotoTarget != NO_OPCODE)  // Rest of chunk is merged.
+		{
+			uint16_t goto_offset = layout.GetOffset(layout.Thread(piece.gotoTarget));
+			*datacur = 0x07; datacur++;
+			memcpy(datacur, &goto_offset, 2); datacur += 2;
+		}
+	}
+}
+
+// Write header of iscEntry with slots pointing where layout put them.
+static uint8_t* WriteEntryHeader(
+	uint8_t* datacur,
+	const IScript& isc,
+	const CodeLayout& layout,
+	const IScriptEntry* iscEntry)
+{
+	memcpy(datacur, "SCPE", 4); datacur += 4;
+	*datacur = iscEntry->type; datacur++;
+	*datacur = 0; datacur++;
+	*datacur = 0; datacur++;
+	*datacur = 0; datacur++;
+
+	for(uint32_t i = 0; i < iscEntry->count; i++)
+	{
+		OpcodeHandle opc = isc.GetEntryOpcode(iscEntry, i);
+		if(opc != NO_OPCODE)
+		{
+			uint16_t opc_offset = layout.GetOffset(layout.Thread(opc));
+			memcpy(datacur, &opc_offset, 2);
+			datacur += 2;
+		}
+		else
+		{
+			*datacur = 0; datacur++;
+			*datacur = 0; datacur++;
+		}
+	}
+	return datacur;
+}
+
+// (entry ID, header offset) of written entries, sorted by ID.
+typedef std::vector<std::pair<uint16_t, uint16_t> > EntryOffsetList;
+
+static bool LessEntryID(const std::pair<uint16_t, uint16_t>& lhs, uint16_t entryID)
+{
+	return lhs.first < entryID;
+}
+
+// Log error, and hand it to caller too.
+static FixStatus Fail(FixStatus status, const std::string& message, std::string* error)
+{
+	Log("\n[Error] %s\n", message.c_str());
+	if(error) *error = message;
+	return status;
+}
+
+uint8_t* BufferFixOutput::Create(uint32_t size)
+{
+	buffer.assign(size, 0);
+	return buffer.data();
+}
+
+uint8_t* FileFixOutput::Create(uint32_t size)
+{
+	return _file.Create(_fname, size) ? _file.data() : nullptr;
+}
+
+bool FileFixOutput::Commit()
+{
+	return _file.Commit();
+}
+
+/*
+Rebuild the whole iscript from scratch. Original entries user iscript
+didn't override keep the original code they reach, user entries get
+what userRoots reach. Both are laid out back to back from offset 2, so
+whatever no entry reaches anymore is gone. Original and user code are
+laid out separately : code of one never gets merged into the other.
+*/
+static FixStatus WriteCompacted(
+	const OriginalIScript& orig,
+	const IScript& userisc,
+	const std::set<uint16_t>& ids_merge,
+	const std::set<uint16_t>& ids_emit,
+	const std::vector<OpcodeHandle>& userRoots,
+	const ChunkSet& userChunks,
+	const FixOptions& options,
+	FixOutput* output,
+	std::string* error)
+{
+	PhaseTimer allocateTimer(PHASE_ALLOCATE);
+	const IScript& origisc = *orig.model;
+
+	std::vector<OpcodeHandle> origRoots;
+	ChunkSet origChunks;
+	uint32_t origEntryCount = 0;
+	for(size_t i = 0; i < orig.idCount; i++)
+	{
+		uint16_t entryID = orig.ids[i];
+		if(ids_emit.count(entryID)) continue;
+		origEntryCount++;
+		origChunks |= orig.entryUsage.find(entryID)->second.chunks;
+		const IScriptEntry* iscEntry = origisc.GetEntry(entryID);
+		for(uint32_t j = 0; j < iscEntry->count; j++)
+		{
+			origRoots.push_back(origisc.GetEntryOpcode(iscEntry, j));
+		}
+	}
+
+	const ChunkSet noFixed;
+	const std::vector<CodeGap> noGaps;
+	CodeLayout origLayout, userLayout;
+	origLayout.Build(origisc, origRoots, origChunks, noFixed, options.optimize);
+	origLayout.Place(noGaps, 2);  // Offsets 0-1 hold entry table offset.
+	userLayout.Build(userisc, userRoots, userChunks, noFixed, options.optimize);
+	userLayout.Place(noGaps, origLayout.GetEndOffset());
+	uint32_t alloc_addr = userLayout.GetEndOffset();
+	Log(" - %d bytes of original code kept for %d entries, %d bytes of custom code.\n",
+		(int)(origLayout.GetEndOffset() - 2), (int)origEntryCount,
+		(int)(alloc_addr - origLayout.GetEndOffset()));
+
+	EntryOffsetList entryOffsets;
+	for(uint16_t entryID : ids_merge)
+	{
+		const IScript& isc = ids_emit.count(entryID) ? userisc : origisc;
+		entryOffsets.push_back(std::make_pair(entryID, (uint16_t)alloc_addr));
+		alloc_addr += 8 + isc.GetEntry(entryID)->count * 2;
+	}
+	alloc_addr += ids_merge.size() * 4 + 4;
+
+	if(alloc_addr > 0x10000)
+	{
+		return Fail(FIX_OVERFLOW, "iscript.bin overflow, even compacted. (" +
+			std::to_string((long long)alloc_addr) + " bytes)", error);
+	}
+	Log(" - Compacted to %d bytes.\n", (int)alloc_addr);
+	allocateTimer.Stop();
+	AddCount(COUNT_OUTPUT_BYTES, alloc_addr);
+
+	PhaseTimer emitTimer(PHASE_EMIT);
+	uint8_t* datastart = output->Create(alloc_addr);
+	if(!datastart)
+	{
+		return Fail(FIX_CANNOT_WRITE, "Cannot create " + output->GetName() + ".", error);
+	}
+	WritePieces(datastart, origisc, origLayout);
+	WritePieces(datastart, userisc, userLayout);
+	uint8_t* datacur = datastart + userLayout.GetEndOffset();
+
+	for(uint16_t entryID : ids_merge)
+	{
+		if(ids_emit.count(entryID))
+		{
+			datacur = WriteEntryHeader(
+				datacur, userisc, userLayout, userisc.GetEntry(entryID));
+		}
+		else
+		{
+			datacur = WriteEntryHeader(
+				datacur, origisc, origLayout, origisc.GetEntry(entryID));
+		}
+	}
+
+	uint16_t isc_entrytb_offset = datacur - datastart;
+	memcpy(datastart, &isc_entrytb_offset, 2);
+	for(auto& it : entryOffsets)
+	{
+		memcpy(datacur, &it.first, 2); datacur += 2;
+		memcpy(datacur, &it.second, 2); datacur += 2;
+	}
+	memcpy(datacur, "\xFF\xFF\x00\x00", 4); datacur += 4;
+	assert(datacur - datastart == alloc_addr);
+
+	if(!output->Commit())
+	{
+		return Fail(FIX_CANNOT_WRITE, "Cannot write " + output->GetName() + ".", error);
+	}
+	return FIX_OK;
+}
+
+std::string GetFixedFileName(const std::string& ifname)
+{
+	return ifname.substr(0, ifname.size() - 4) + " fixed.bin";
+}
+
+static FixStatus FixUserIScript(
+	const OriginalIScript& orig,
+	IScript& userisc,
+	FixOutput* output,
+	const FixOptions& options,
+	std::string* error)
+{
+	PhaseTimer readTimer(PHASE_READ);
+
+	// Collect custom used iscript entry IDs.
+	std::vector<uint16_t> userisc_idv = userisc.EnumEntries();
+	std::set<uint16_t> userisc_ids(userisc_idv.begin(), userisc_idv.end());
+	userisc_idv.clear();
+
+
+	std::set<uint16_t> ids_merge, ids_diff;
+	// Merge
+	std::set_union(
+		userisc_ids.begin(), userisc_ids.end(),
+		orig.ids, orig.ids + orig.idCount,
+		std::inserter(ids_merge, ids_merge.begin())
+		);
+
+	// Diff
+	std::set_difference(
+		userisc_ids.begin(), userisc_ids.end(),
+		orig.ids, orig.ids + orig.idCount,
+		std::inserter(ids_diff, ids_diff.begin())
+		);
+
+
+
+	// Shared entries whose content user iscript changed.
+	std::set<uint16_t> ids_changed;
+	if(options.contentDiff)
+	{
+		Log("[2-1] Comparing shared entries.\n");
+		std::vector<uint16_t> ids_shared;
+		std::set_intersection(
+			userisc_ids.begin(), userisc_ids.end(),
+			orig.ids, orig.ids + orig.idCount,
+			std::back_inserter(ids_shared)
+			);
+
+		userisc.DecodeEntries(ids_shared);
+		for(uint16_t entryID : ids_shared)
+		{
+			auto it = orig.entryHashes.find(entryID);
+			if(it == orig.entryHashes.end() ||
+				it->second != userisc.GetEntryHash(entryID))
+			{
+				ids_changed.insert(entryID);
+			}
+		}
+		Log(" - %d of %d shared entries changed.\n",
+			(int)ids_changed.size(), (int)ids_shared.size());
+	}
+
+	// New & changed entries get written out.
+	std::set<uint16_t> ids_emit(ids_diff);
+	ids_emit.insert(ids_changed.begin(), ids_changed.end());
+
+
+	readTimer.Stop();
+
+	// Allocate opcodes.
+	Log("[3] Allocating custom opcodes.\n");
+	PhaseTimer allocateTimer(PHASE_ALLOCATE);
+	userisc.DecodeEntries(std::vector<uint16_t>(ids_emit.begin(), ids_emit.end()));
+	IScriptDependency isd;
+	PhaseTimer dependencyTimer(PHASE_DEPENDENCY);
+	for(uint16_t entryID : ids_emit)
+	{
+		LogProgress("\r - Updating depencency of entry %d...", entryID);
+		userisc.UpdateDependency(entryID, &isd);
+	}
+	dependencyTimer.Stop();
+	// Nothing gets decoded past this point.
+	AddCount(COUNT_CHUNKS, userisc.GetChunkCount());
+	AddCount(COUNT_ARENA_BYTES, userisc.GetArenaBytes());
+	AddCount(COUNT_ARENA_BLOCKS, userisc.GetArenaBlocks());
+
+	// Chunks original code can stand in for are not emitted.
+	ChunkSet aliased;
+	if(options.dedup)
+	{
+		aliased = DedupChunks(userisc, isd.chkSet, orig.chunkIndex);
+		int aliasedBytes = 0;
+		aliased.ForEach([&](uint32_t chkID)
+		{
+			aliasedBytes += userisc.GetChunk(chkID).size;
+		});
+		Log("\n - %d chunks (%d bytes) reuse original code.\n",
+			(int)aliased.Count(), aliasedBytes);
+		AddCount(COUNT_DEDUP_HITS, aliased.Count());
+	}
+
+	// Lay out opcodes of emitted entries.
+	std::vector<OpcodeHandle> roots;
+	for(uint16_t entryID : ids_emit)
+	{
+		const IScriptEntry* iscEntry = userisc.GetEntry(entryID);
+		for(uint32_t i = 0; i < iscEntry->count; i++)
+		{
+			roots.push_back(userisc.GetEntryOpcode(iscEntry, i));
+		}
+	}
+
+	uint16_t origdataend = orig.dataend;
+	CodeLayout layout;
+	layout.Build(userisc, roots, isd.chkSet, aliased, options.optimize);
+	std::vector<CodeGap> gaps;
+	if(options.fillGaps) gaps = FindOriginalGaps(orig, ids_changed, userisc, aliased);
+	layout.Place(gaps, origdataend);
+	uint32_t alloc_addr = layout.GetEndOffset();
+	Log("\n - %d bytes of custom opcodes appended.\n", (int)(alloc_addr - origdataend));
+	if(options.fillGaps)
+	{
+		uint32_t gapBytes = 0;
+		for(const CodeGap& gap : gaps) gapBytes += gap.size;
+		Log(" - %d of %d free bytes in original data filled.\n",
+			(int)layout.GetGapBytes(), (int)gapBytes);
+	}
+	if(options.optimize)
+	{
+		Log(" - %d pointers threaded past gotos.\n",
+			(int)layout.GetThreadedGotos());
+		Log(" - %d dead bytes dropped, %d bytes merged into other tails.\n",
+			(int)layout.GetDeadBytes(), (int)layout.GetMergedBytes());
+	}
+
+	// Allocate entries.
+	Log("[4] Allocating iscript entries.\n");
+	EntryOffsetList entryOffsets;
+	for(uint16_t entryID : ids_emit)
+	{
+		IScriptEntry* iscEntry = userisc.GetEntry(entryID);
+		entryOffsets.push_back(std::make_pair(entryID, (uint16_t)alloc_addr));
+		alloc_addr += 8 + iscEntry->count * 2;
+	}
+
+	// Allocate entry table.
+	alloc_addr += ids_merge.size() * 4 + 4;
+
+	if(alloc_addr > 0x10000)  // iscript.bin too big
+	{
+		if(!options.compact)
+		{
+			return Fail(FIX_OVERFLOW, "iscript.bin overflow. (-C may help)", error);
+		}
+
+		Log("[4-1] Appending overflows, compacting whole iscript.\n");
+		allocateTimer.Stop();
+		FixStatus status = WriteCompacted(orig, userisc, ids_merge, ids_emit,
+			roots, isd.chkSet, options, output, error);
+		if(status != FIX_OK) return status;
+		Log("[6] Done!\n");
+		return FIX_OK;
+	}
+
+
+
+	// Write payload straight into output.
+	allocateTimer.Stop();
+	AddCount(COUNT_OUTPUT_BYTES, alloc_addr);
+	AddCount(COUNT_APPENDED_BYTES, layout.GetEndOffset() - origdataend);
+	Log("[5] Writing payload.\n");
+	PhaseTimer emitTimer(PHASE_EMIT);
+	uint8_t* datastart = output->Create(alloc_addr);
+	if(!datastart)
+	{
+		return Fail(FIX_CANNOT_WRITE, "Cannot create " + output->GetName() + ".", error);
+	}
+	uint8_t* datacur = datastart;
+
+	// Write original data
+	memcpy(datacur, orig.data, origdataend);
+	datacur += origdataend;
+
+	WritePieces(datastart, userisc, layout);
+	datacur = datastart + layout.GetEndOffset();
+
+	// Write user iscript entries.
+	for(auto& it : entryOffsets)
+	{
+		IScriptEntry* iscEntry = userisc.GetEntry(it.first);
+		datacur = WriteEntryHeader(datacur, userisc, layout, iscEntry);
+	}
+
+	// Write iscript tables.
+	uint16_t isc_entrytb_offset = datacur - datastart;
+	memcpy(datastart, &isc_entrytb_offset, 2);
+
+	uint16_t origisctblen = (uint16_t)(orig.idCount * 4);
+	memcpy(datacur, orig.table, origisctblen);
+
+	// Point rows of changed entries to their new copies.
+	if(!ids_changed.empty())
+	{
+		for(uint16_t row = 0; row < origisctblen; row += 4)
+		{
+			uint16_t entryID;
+			memcpy(&entryID, datacur + row, 2);
+			auto it = std::lower_bound(
+				entryOffsets.begin(), entryOffsets.end(), entryID, LessEntryID);
+			if(it != entryOffsets.end() && it->first == entryID)
+			{
+				memcpy(datacur + row + 2, &it->second, 2);
+			}
+		}
+	}
+	datacur += origisctblen;
+
+	// Rows of new entries.
+	for(auto& it : entryOffsets)
+	{
+		if(std::binary_search(orig.ids, orig.ids + orig.idCount, it.first)) continue;
+		memcpy(datacur, &it.first, 2); datacur += 2;
+		memcpy(datacur, &it.second, 2); datacur += 2;
+	}
+
+	memcpy(datacur, "\xFF\xFF\x00\x00", 4); datacur += 4;
+	assert(datacur - datastart == alloc_addr);
+
+	if(!output->Commit())
+	{
+		return Fail(FIX_CANNOT_WRITE, "Cannot write " + output->GetName() + ".", error);
+	}
+	emitTimer.Stop();
+
+	Log("[6] Done!\n");
+	return FIX_OK;
+}
+
+// Decoding throws on malformed input, from wherever it notices.
+template<typename F>
+static FixStatus CatchErrors(F fix, std::string* error)
+{
+	try
+	{
+		return fix();
+	}
+	catch(const FatalErrorException& e)
+	{
+		return Fail(FIX_MALFORMED_INPUT, e.what(), error);
+	}
+	catch(const std::bad_alloc&)
+	{
+		return Fail(FIX_OUT_OF_MEMORY, "Out of memory.", error);
+	}
+}
+
+FixStatus FixIScriptData(
+	const OriginalIScript& orig,
+	const uint8_t* data,
+	size_t size,
+	FixOutput* output,
+	const FixOptions& options,
+	std::string* error)
+{
+	return CatchErrors([&]() -> FixStatus
+	{
+		// Read user iscript
+		Log("[2] Reading custom iscript.\n");
+		PhaseTimer readTimer(PHASE_READ);
+		// Only entries in ids_emit and what they reach are decoded.
+		IScript userisc(data, size, true);
+		Log("\n");
+		readTimer.Stop();
+		return FixUserIScript(orig, userisc, output, options, error);
+	}, error);
+}
+
+FixStatus FixIScriptModel(
+	const OriginalIScript& orig,
+	IScript& userisc,
+	FixOutput* output,
+	const FixOptions& options,
+	std::string* error)
+{
+	return CatchErrors([&]() -> FixStatus
+	{
+		return FixUserIScript(orig, userisc, output, options, error);
+	}, error);
+}
+
+bool FixIScript(
+	const OriginalIScript& orig,
+	const std::string& ifname,
+	const std::string& ofname,
+	const FixOptions& options)
+{
+	MappedFile userisc_file(ifname);
+	if(!userisc_file.IsOpen())
+	{
+		Log("[Error] Cannot open %s.\n", ifname.c_str());
+		return false;
+	}
+	FileFixOutput output(ofname);
+	return FixIScriptData(
+		orig, userisc_file.data(), userisc_file.size(), &output, options) == FIX_OK;
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#ifndef FIXER_HEADER_
+#define FIXER_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dedup.h"
+#include "layout.h"
+#include "mappedfile.h"
+
+struct FixOptions
+{
+	FixOptions() :
+		contentDiff(false), dedup(false), optimize(false), fillGaps(false),
+		compact(false) {}
+
+	// Also emit entries original iscript has, when user iscript changed
+	// their content. Entry table rows of those get overridden.
+	bool contentDiff;
+
+	// Reuse original code for user chunks identical to it, instead of
+	// appending copies.
+	bool dedup;
+
+	// Drop unreachable user opcodes and merge identical tails of chunks.
+	// See CodeLayout.
+	bool optimize;
+
+	// Place user opcodes into parts of original data no remaining entry
+	// uses before appending them.
+	bool fillGaps;
+
+	// When appending doesn't fit in 64KB, rebuild the whole iscript from
+	// code live entries still reach instead. Every offset moves.
+	bool compact;
+};
+
+/*
+Original iscript, read once and shared read-only by every input fixed in
+the same run.
+*/
+class IScript;
+
+struct OriginalIScript
+{
+	// Bundled iscript.bin, compiled in by iscript_gen.
+	OriginalIScript();
+	// Any other original. Either way, only the entry table is read here.
+	OriginalIScript(const uint8_t* data, size_t size);
+	~OriginalIScript();
+
+	const uint8_t* data;
+	size_t size;
+	uint16_t dataend;  // Original entry table starts here.
+	const uint16_t* ids;  // Entry IDs used by original iscript, sorted.
+	size_t idCount;
+	// Rows of original entry table as stored, first row of each ID only.
+	// idCount rows of 4 bytes, without the 0xFFFF terminator.
+	const uint8_t* table;
+
+	// Decode original iscript & build what options need. Call once before
+	// fixing anything. With modelFile, decoded model is loaded from there
+	// when it matches, and saved there when it doesn't.
+	void Prepare(const FixOptions& options, const std::string& modelFile = std::string());
+
+	// Structural hash of every original entry, for contentDiff.
+	std::map<uint16_t, uint64_t> entryHashes;
+	// Original code, for dedup.
+	ChunkIndex chunkIndex;
+
+	// Fully decoded original, for compact. Only const methods are used
+	// after Prepare, so jobs can share it.
+	std::unique_ptr<IScript> model;
+
+	// What each original entry keeps alive, for fillGaps & compact.
+	struct EntryUsage
+	{
+		uint16_t headerOffset;
+		uint16_t headerSize;
+		ChunkSet chunks;
+	};
+	std::map<uint16_t, EntryUsage> entryUsage;
+	std::vector<CodeGap> chunkRanges;  // By original chunk ID.
+
+private:
+	void ReadEntryTable();
+
+	std::vector<uint16_t> _idStorage;
+	std::vector<uint8_t> _tableStorage;
+
+	OriginalIScript(const OriginalIScript&);
+	OriginalIScript& operator=(const OriginalIScript&);
+};
+
+// "foo.bin" -> "foo fixed.bin"
+std::string GetFixedFileName(const std::string& ifname);
+
+// What stopped fixing, if anything.
+enum FixStatus
+{
+	FIX_OK,
+	FIX_MALFORMED_INPUT,  // Input isn't a valid iscript.
+	FIX_OVERFLOW,  // Result doesn't fit in 64KB.
+	FIX_CANNOT_WRITE,  // Output can't be created or written.
+	FIX_OUT_OF_MEMORY,
+};
+
+/*
+Where fixed iscript goes. Once its size is known, Create is called for a
+buffer of exactly that size, which is filled in place and then committed.
+*/
+class FixOutput
+{
+public:
+	virtual ~FixOutput() {}
+
+	// nullptr when no buffer can be made.
+	virtual uint8_t* Create(uint32_t size) = 0;
+	virtual bool Commit() = 0;
+	// For error messages.
+	virtual std::string GetName() const = 0;
+};
+
+// Fixed iscript kept in memory.
+class BufferFixOutput : public FixOutput
+{
+public:
+	uint8_t* Create(uint32_t size) override;
+	bool Commit() override { return true; }
+	std::string GetName() const override { return "output buffer"; }
+
+	std::vector<uint8_t> buffer;
+};
+
+// Fixed iscript written straight into a mapped file. Nothing is left at
+// fname unless Commit succeeds.
+class FileFixOutput : public FixOutput
+{
+public:
+	explicit FileFixOutput(const std::string& fname) : _fname(fname) {}
+
+	uint8_t* Create(uint32_t size) override;
+	bool Commit() override;
+	std::string GetName() const override { return _fname; }
+
+private:
+	std::string _fname;
+	MappedOutputFile _file;
+};
+
+/*
+Append entries of user iscript in data that original iscript lacks to
+the original one, and write the result to output. Errors are logged,
+and with error given, the message also goes there. Nothing escapes :
+malformed input and running out of memory come back as status too.
+*/
+FixStatus FixIScriptData(
+	const OriginalIScript& orig,
+	const uint8_t* data,
+	size_t size,
+	FixOutput* output,
+	const FixOptions& options,
+	std::string* error = nullptr);
+
+/*
+Same for user iscript decoded, maybe partly, by userisc. Whatever else
+it needs is decoded on top. Used to fix edited versions without decoding
+everything again, see IScript::ReuseDecoded.
+*/
+FixStatus FixIScriptModel(
+	const OriginalIScript& orig,
+	IScript& userisc,
+	FixOutput* output,
+	const FixOptions& options,
+	std::string* error = nullptr);
+
+/*
+Same for user iscript at ifname, written to ofname. Returns false when
+the input can't be read or fixed, or the result doesn't fit in 64KB,
+even compacted when options ask for it.
+*/
+bool FixIScript(
+	const OriginalIScript& orig,
+	const std::string& ifname,
+	const std::string& ofname,
+	const FixOptions& options);
+
+#endif
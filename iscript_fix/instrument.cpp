@@ -0,0 +1,123 @@
+#include "instrument.h"
+#include "threadlocal.h"
+
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <chrono>
+#endif
+
+THREAD_LOCAL_VALUE(Instrumentation*, t_instrumentation);
+
+static const char* const phaseNames[PHASE_COUNT] =
+{
+	"load", "read", "allocate", "emit", "decode", "link", "dependency",
+};
+
+static const char* const counterNames[COUNTER_COUNT] =
+{
+	"opcodes", "chunks", "output_bytes", "appended_bytes", "dedup_hits", "arena_bytes",
+	"arena_blocks", "reused_opcodes",
+};
+
+Instrumentation::Instrumentation()
+{
+	for(int i = 0; i < PHASE_COUNT; i++) ms[i] = 0;
+	for(int i = 0; i < COUNTER_COUNT; i++) count[i] = 0;
+}
+
+const char* GetPhaseName(Phase phase)
+{
+	return phaseNames[phase];
+}
+
+const char* GetCounterName(Counter counter)
+{
+	return counterNames[counter];
+}
+
+double GetMonotonicMs()
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return now.QuadPart * 1000.0 / freq.QuadPart;
+#else
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count() / 1e6;
+#endif
+}
+
+void SetInstrumentation(Instrumentation* inst)
+{
+	t_instrumentation.Set(inst);
+}
+
+void AddCount(Counter counter, uint64_t n)
+{
+	Instrumentation* inst = t_instrumentation.Get();
+	if(inst) inst->count[counter] += n;
+}
+
+PhaseTimer::PhaseTimer(Phase phase)
+	: _target(t_instrumentation.Get()), _phase(phase), _start(0)
+{
+	if(_target) _start = GetMonotonicMs();
+}
+
+PhaseTimer::PhaseTimer(Phase phase, Instrumentation* target)
+	: _target(target), _phase(phase), _start(0)
+{
+	if(_target) _start = GetMonotonicMs();
+}
+
+PhaseTimer::~PhaseTimer()
+{
+	Stop();
+}
+
+void PhaseTimer::Stop()
+{
+	if(_target == nullptr) return;
+	_target->ms[_phase] += GetMonotonicMs() - _start;
+	_target = nullptr;
+}
+
+void AppendJson(std::string* out, const Instrumentation& inst)
+{
+	std::ostringstream os;
+	os << std::fixed << std::setprecision(3) << "\"phases_ms\":{";
+	for(int i = 0; i < PHASE_COUNT; i++)
+	{
+		os << (i ? "," : "") << '"' << phaseNames[i] << "\":" << inst.ms[i];
+	}
+	os << "},\"counters\":{";
+	for(int i = 0; i < COUNTER_COUNT; i++)
+	{
+		os << (i ? "," : "") << '"' << counterNames[i] << "\":" << inst.count[i];
+	}
+	os << "}";
+	out->append(os.str());
+}
+
+void AppendJsonString(std::string* out, const std::string& s)
+{
+	out->push_back('"');
+	for(char c : s)
+	{
+		if(c == '"' || c == '\\') out->push_back('\\');
+		if((unsigned char)c < 0x20)
+		{
+			const char* hex = "0123456789abcdef";
+			out->append("\\u00");
+			out->push_back(hex[(c >> 4) & 15]);
+			out->push_back(hex[c & 15]);
+		}
+		else out->push_back(c);
+	}
+	out->push_back('"');
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#ifndef INSTRUMENT_HEADER_
+#define INSTRUMENT_HEADER_
+
+#include <cstdint>
+#include <string>
+
+/*
+Phase timers & counters of a fix job. Like log capture, a thread points
+at the Instrumentation of the job it runs, and timers & counters anywhere
+below add to it. Threads pointing nowhere measure nothing.
+
+Numbered phases follow console steps and don't overlap : load [1], read
+[2], allocate [3]-[4] and emit [5]. decode, link & dependency are spent
+inside them, wherever the model gets decoded or walked.
+*/
+
+enum Phase
+{
+	PHASE_LOAD,
+	PHASE_READ,
+	PHASE_ALLOCATE,
+	PHASE_EMIT,
+	PHASE_DECODE,
+	PHASE_LINK,
+	PHASE_DEPENDENCY,
+	PHASE_COUNT
+};
+
+enum Counter
+{
+	COUNT_OPCODES,  // Opcodes decoded
+	COUNT_CHUNKS,  // Chunks of user iscript
+	COUNT_OUTPUT_BYTES,
+	COUNT_APPENDED_BYTES,  // Opcode bytes placed after original data
+	COUNT_DEDUP_HITS,  // User chunks aliased to original code
+	COUNT_ARENA_BYTES,  // Reserved by the arena of user iscript
+	COUNT_ARENA_BLOCKS,  // Blocks behind those bytes
+	COUNT_REUSED_OPCODES,  // Taken over from an earlier version instead of decoded
+	COUNTER_COUNT
+};
+
+struct Instrumentation
+{
+	Instrumentation();
+
+	double ms[PHASE_COUNT];
+	uint64_t count[COUNTER_COUNT];
+};
+
+const char* GetPhaseName(Phase phase);
+const char* GetCounterName(Counter counter);
+
+// Monotonic milliseconds from an arbitrary start. VS2013 steady_clock is
+// neither steady nor fine-grained, so this doesn't rely on it.
+double GetMonotonicMs();
+
+// Send timers & counters of calling thread to inst. nullptr stops that.
+void SetInstrumentation(Instrumentation* inst);
+
+void AddCount(Counter counter, uint64_t n);
+
+// Add time until destruction or Stop to phase of calling thread, or of
+// target if given.
+class PhaseTimer
+{
+public:
+	explicit PhaseTimer(Phase phase);
+	PhaseTimer(Phase phase, Instrumentation* target);
+	~PhaseTimer();
+
+	void Stop();
+
+private:
+	PhaseTimer(const PhaseTimer&);
+	PhaseTimer& operator=(const PhaseTimer&);
+
+	Instrumentation* _target;
+	Phase _phase;
+	double _start;
+};
+
+// Append inst as members of a JSON object : "phases_ms":{...},"counters":{...}
+void AppendJson(std::string* out, const Instrumentation& inst);
+
+// Append s as a quoted, escaped JSON string.
+void AppendJsonString(std::string* out, const std::string& s);
+
+#endif
@@ -1,11 +1,17 @@
-#include <cassert>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <stack>
 #include <set>
+#include <thread>
 
-#include <fstream>
-
+#include "instrument.h"
 #include "iscript.h"
+#include "log.h"
+#include "parallel.h"
 
 std::map<uint32_t, uint32_t> entryType_opcodeNum_map = {
 	{ 0, 2 },
@@ -25,245 +31,519 @@ std::map<uint32_t, uint32_t> entryType_opcodeNum_map = {
 	{ 29, 28 },
 };
 
-void GetOpcode(std::istream& is, Opcode* opc);
-
-IScript::IScript(std::istream& is)
+// Bounds-checked little-endian reads from the source buffer.
+static uint16_t ReadU16(const uint8_t* data, size_t size, size_t offset)
 {
-	// Opcodes
-	Opcode* opcodeMap[65536];
-	for(int i = 0; i < 65536; i++)
+	if(offset + 2 > size)
 	{
-		Opcode* p = new Opcode;
-		memset(p, 0, sizeof(Opcode));
-		p->size = 0xFFFF;
-		opcodeMap[i] = p;
+		FatalError("Read of offset %d out of file (size %d).",
+			(int)offset, (int)size);
 	}
-	
-	// -----------------------------------------------------------------------
+	return data[offset] | (data[offset + 1] << 8);
+}
+
+static uint32_t ReadU32(const uint8_t* data, size_t size, size_t offset)
+{
+	return ReadU16(data, size, offset) | (ReadU16(data, size, offset + 2) << 16);
+}
+
+// Reorder column so that row i becomes old row order[i]. Column storage is
+// reused, so the arena doesn't grow on every link.
+template<typename T>
+static void Permute(ArenaVector<T>& column, const std::vector<OpcodeHandle>& order)
+{
+	std::vector<T> permuted(order.size());
+	for(size_t i = 0; i < order.size(); i++) permuted[i] = column[order[i]];
+	std::copy(permuted.begin(), permuted.end(), column.begin());
+}
 
+IScript::IScript(
+	const uint8_t* data, size_t size,
+	bool lazy, unsigned decodeThreads)
+	: _data(data), _size(size),
+	_entryOffsets(std::less<uint16_t>(), ArenaAllocator<uint16_t>(&_arena)),
+	_entries(std::less<uint16_t>(), ArenaAllocator<IScriptEntry>(&_arena)),
+	_entrySlotOffsets(ArenaAllocator<uint16_t>(&_arena)),
+	_entrySlots(ArenaAllocator<OpcodeHandle>(&_arena)),
+	_opcodes(&_arena),
+	_chunks(ArenaAllocator<OpcodeChunk>(&_arena)),
+	_generation(0), _linkedOpcodes(0), _linkedSlots(0),
+	_chunkGraphGeneration(0), _hasherGeneration(0)
+{
 	// Locate entry list
-	uint16_t entrylistoffset;
-	is.seekg(0);
-	is.read((char*)&entrylistoffset, 2);
-	is.seekg(entrylistoffset);
+	size_t entrylistoffset = ReadU16(data, size, 0);
 
 	// Get list of entries.
-	std::map<uint16_t, uint16_t> entry_offset_map;
-	printf("Getting list of iscript entries...\n");
+	Log("Getting list of iscript entries...\n");
 	while(1)
 	{
 		uint16_t entryID, entryOffset;
-		is.read((char*)&entryID, 2);
+		entryID = ReadU16(data, size, entrylistoffset);
 		if(entryID == 0xFFFF) break;  // End of list
-		is.read((char*)&entryOffset, 2);
-		entry_offset_map.insert(std::make_pair(entryID, entryOffset));
-		printf("\r - Entry : Id %5d, Offset %5d", entryID, entryOffset);
+		entryOffset = ReadU16(data, size, entrylistoffset + 2);
+		entrylistoffset += 4;
+		_entryOffsets.insert(std::make_pair(entryID, entryOffset));
+		LogProgress("\r - Entry : Id %5d, Offset %5d", entryID, entryOffset);
 	}
+	Log("\n");
+
+	// Lazy mode stops here. Entries get decoded when they are first reached.
+	if(lazy) return;
 
 	// From opcode entries, get opcode parse start offsets.
 	std::stack<uint16_t> opcodeParseStartOffsets;
 
-	printf("\nGetting decompile starting points...\n");
-	for(auto& entry_offset : entry_offset_map)
+	Log("Getting decompile starting points...\n");
+	for(auto& entry_offset : _entryOffsets)
 	{
-		uint16_t entryID = entry_offset.first;
-		uint16_t entryOffset = entry_offset.second;
-		IScriptEntry* isce = new IScriptEntry;
-		_entries.insert(std::make_pair(entryID, isce));
+		IndexEntry(entry_offset.first, opcodeParseStartOffsets);
+	}
 
-		is.seekg(entryOffset);
+	// Parse all opcodes and required things.
+	if(decodeThreads > 1)
+	{
+		DecodeOpcodesParallel(opcodeParseStartOffsets, decodeThreads);
+	}
+	else DecodeOpcodes(opcodeParseStartOffsets);
 
-		uint32_t magic, entryType;
-		is.read((char*)&magic, 4);
-		assert(magic == 'EPCS');  // Magic number check.
+	Log("Iscript reading complete!\n");
+	Log(" - Total number of iscript chunks : %d\n", (int)_chunks.size());
+}
 
-		is.read((char*)&entryType, 4);
-		int opcodeNum = entryType_opcodeNum_map[entryType];
-		isce->type = entryType;
+IScriptEntry* IScript::IndexEntry(
+	uint16_t entryID,
+	std::stack<uint16_t>& opcodeParseStartOffsets) const
+{
+	uint16_t entryOffset = _entryOffsets.find(entryID)->second;
+	IScriptEntry& isce = _entries[entryID];
 
-		printf("\r - Entry : Id %5d, Type %d  ", entryID, entryType);
-		for(int i = 0; i < opcodeNum; i++)
-		{
-			uint16_t opcParseReqOffset;
-			is.read((char*)&opcParseReqOffset, 2);
+	uint32_t magic, entryType;
+	magic = ReadU32(_data, _size, entryOffset);
+	if(magic != 'EPCS')  // Magic number check.
+	{
+		FatalError("No entry header at %d for entry %d.",
+			(int)entryOffset, (int)entryID);
+	}
 
-			if(opcParseReqOffset)  // There is starting point
-			{
-				isce->opcodelist.push_back(opcodeMap[opcParseReqOffset]);
-				// Queue parse from the offset
-				opcodeParseStartOffsets.push(opcParseReqOffset);
-			}
-			else
-			{
-				isce->opcodelist.push_back(nullptr);
-			}
+	// Unknown types have no slots. Map is only read, as jobs share it.
+	entryType = ReadU32(_data, _size, entryOffset + 4);
+	auto typeIt = entryType_opcodeNum_map.find(entryType);
+	int opcodeNum = typeIt == entryType_opcodeNum_map.end() ? 0 : typeIt->second;
+	isce.type = entryType;
+	isce.first = _entrySlotOffsets.size();
+	isce.count = opcodeNum;
+
+	LogProgress("\r - Entry : Id %5d, Type %d  ", entryID, entryType);
+	for(int i = 0; i < opcodeNum; i++)
+	{
+		uint16_t opcParseReqOffset =
+			ReadU16(_data, _size, entryOffset + 8 + 2 * i);
+
+		// Slot handles are resolved by LinkOpcodes.
+		_entrySlotOffsets.push_back(opcParseReqOffset);
+		_entrySlots.push_back(NO_OPCODE);
+		if(opcParseReqOffset)  // There is starting point
+		{
+			// Queue parse from the offset
+			opcodeParseStartOffsets.push(opcParseReqOffset);
 		}
 	}
+	return &isce;
+}
 
-	// Parse all opcodes and required things.
-	printf("\nDecoding opcodes [0]");
-	int decoded_opcode_num = 0; 
-
+void IScript::DecodeOpcodes(std::stack<uint16_t>& opcodeParseStartOffsets) const
+{
+	Log("\nDecoding opcodes [0]");
+	PhaseTimer decodeTimer(PHASE_DECODE);
+	size_t oldCount = _opcodes.count();
 
 	while(!opcodeParseStartOffsets.empty())
 	{
 		uint16_t opcodeOffset = opcodeParseStartOffsets.top();
 		opcodeParseStartOffsets.pop();
-		if(opcodeMap[opcodeOffset]->size != 0xFFFF)  // Already parsed.
+		if(_opcodeIndex.Contains(opcodeOffset))  // Already parsed.
 			continue;
 
-		Opcode* opc = opcodeMap[opcodeOffset];
-		is.seekg(opcodeOffset);
-		GetOpcode(is, opc);
-		if(opc->pointer.ptr != nullptr)  // Pointer detected
+		OpcodeHandle opc = GetOpcode(_data, _size, opcodeOffset, &_opcodes);
+		_opcodeIndex.Insert(opcodeOffset);
+		if(_opcodes.argOffset[opc])  // Pointer detected
 		{
-			uint16_t pOpcOffset = reinterpret_cast<uint16_t>(opc->pointer.ptr);
-			// Translate to real pointer.
-			opc->pointer.ptr =
-				opcodeMap[pOpcOffset];
-			opcodeParseStartOffsets.push(pOpcOffset);
+			// Translated to handle by LinkOpcodes.
+			opcodeParseStartOffsets.push(_opcodes.targetOffset[opc]);
 		}
 
 		// Queue parse of next opcode.
-		uint8_t opcodeType = opc->plaindata[0];
-		if(!(
-			opcodeType == 0x07 ||  // goto
-			opcodeType == 0x16 ||  // end
-			opcodeType == 0x36     // return
-			))
+		if(!IsTerminator(_opcodes.type[opc]))
 		{
-			opcodeParseStartOffsets.push(opcodeOffset + opc->size);
+			opcodeParseStartOffsets.push(opcodeOffset + _opcodes.size[opc]);
 		}
 
-		decoded_opcode_num++;
-		printf("\rDecoding opcodes [%d]", decoded_opcode_num);
+		LogProgress("\rDecoding opcodes [%d]", (int)(_opcodes.count() - oldCount));
 	}
+	Log("\n");
+	decodeTimer.Stop();
+	AddCount(COUNT_OPCODES, _opcodes.count() - oldCount);
 
+	if(_opcodes.count() != _linkedOpcodes) LinkOpcodes(oldCount, 1);
+	else LinkNewSlots();
+}
 
-	// Intermediate cleanup : free unused offsets
-	printf("\nPost-processing iscripts...\n");
-	for(int i = 0; i < 65536; i++)
+/*
+Multi-threaded DecodeOpcodes. Every worker has its own deque of offsets
+to decode and steals from others when it runs dry. An offset is claimed
+by atomically setting its bit in a shared bitmap, so each opcode gets
+decoded by exactly one worker. Workers decode into tables of their own,
+which are appended to _opcodes afterwards. LinkOpcodes sorts them anyway,
+so the result doesn't depend on scheduling.
+*/
+namespace
+{
+	struct DecodeWorker
 	{
-		if(opcodeMap[i]->size == 0xFFFF)
-		{
-			delete opcodeMap[i];
-			opcodeMap[i] = nullptr;
-		}
+		DecodeWorker() : table(&arena) {}
+
+		Arena arena;
+		OpcodeTable table;
+		WorkStealingDeque<uint16_t> queue;
+	};
+}
+
+void IScript::DecodeOpcodesParallel(
+	std::stack<uint16_t>& opcodeParseStartOffsets,
+	unsigned threads) const
+{
+	PhaseTimer decodeTimer(PHASE_DECODE);
+	size_t oldCount = _opcodes.count();
+
+	std::unique_ptr<std::atomic<uint64_t>[]> claimed(new std::atomic<uint64_t>[1024]);
+	for(int w = 0; w < 1024; w++) claimed[w] = _opcodeIndex.GetWord(w);
+
+	std::unique_ptr<DecodeWorker[]> workers(new DecodeWorker[threads]);
+	std::atomic<long> pending((long)opcodeParseStartOffsets.size());
+	std::atomic<bool> failed(false);  // Set by a worker that threw.
+	for(unsigned w = 0; !opcodeParseStartOffsets.empty(); w = (w + 1) % threads)
+	{
+		workers[w].queue.Push(opcodeParseStartOffsets.top());
+		opcodeParseStartOffsets.pop();
 	}
 
-	// Link adjacent opcodes.
-	Opcode* prevOpc = nullptr;
-	OpcodeChunk* chk = nullptr;
-	int chkn = 0;
-	for(int off = 0; off < 65536;)
+	Log("\nDecoding opcodes on %d threads...", threads);
+	ParallelRanges(threads, threads, [&](unsigned w, size_t, size_t)
 	{
-		Opcode* opc = opcodeMap[off];
-		if(opc == nullptr)
-		{
-			prevOpc = nullptr;
-			chk = nullptr;
-			off++;
-			continue;
-		}
-		
-		// Append to opcode chunk.
-		if(chk == nullptr)
+		DecodeWorker& worker = workers[w];
+		OpcodeTable& table = worker.table;
+
+		while(!failed)
 		{
-			chk = new OpcodeChunk;
-			chk->allocated_offset = 0xFFFF;
-			chk->size = 0;
-			chkn++;
+			uint16_t opcodeOffset;
+			bool found = worker.queue.Pop(&opcodeOffset);
+			for(unsigned i = 1; !found && i < threads; i++)
+			{
+				found = workers[(w + i) % threads].queue.Steal(&opcodeOffset);
+			}
+			if(!found)
+			{
+				if(pending == 0) break;  // Nothing will be queued anymore.
+				std::this_thread::yield();
+				continue;
+			}
+
+			uint64_t bit = (uint64_t)1 << (opcodeOffset & 63);
+			try
+			{
+				if(!(claimed[opcodeOffset >> 6].fetch_or(bit) & bit))
+				{
+					OpcodeHandle opc = GetOpcode(_data, _size, opcodeOffset, &table);
+
+					// Count new items before this one is done, so pending never
+					// hits 0 while there is work left.
+					if(table.argOffset[opc])  // Pointer detected
+					{
+						pending++;
+						worker.queue.Push(table.targetOffset[opc]);
+					}
+					if(!IsTerminator(table.type[opc]))
+					{
+						pending++;
+						worker.queue.Push(opcodeOffset + table.size[opc]);
+					}
+				}
+			}
+			catch(...)
+			{
+				// pending never gets back to 0 now. Stop the others.
+				failed = true;
+				throw;
+			}
+			pending--;
 		}
+	});
+
+	// Gather rows of every worker.
+	for(unsigned w = 0; w < threads; w++)
+	{
+		const OpcodeTable& table = workers[w].table;
+		_opcodes.type.insert(_opcodes.type.end(), table.type.begin(), table.type.end());
+		_opcodes.size.insert(_opcodes.size.end(), table.size.begin(), table.size.end());
+		_opcodes.offset.insert(_opcodes.offset.end(), table.offset.begin(), table.offset.end());
+		_opcodes.argOffset.insert(_opcodes.argOffset.end(), table.argOffset.begin(), table.argOffset.end());
+		_opcodes.targetOffset.insert(_opcodes.targetOffset.end(), table.targetOffset.begin(), table.targetOffset.end());
+		_opcodes.target.insert(_opcodes.target.end(), table.target.begin(), table.target.end());
+		_opcodes.next.insert(_opcodes.next.end(), table.next.begin(), table.next.end());
+		_opcodes.chunk.insert(_opcodes.chunk.end(), table.chunk.begin(), table.chunk.end());
+		_opcodes.chunkPos.insert(_opcodes.chunkPos.end(), table.chunkPos.begin(), table.chunkPos.end());
+		for(uint16_t off : table.offset) _opcodeIndex.Insert(off);
+	}
+	Log(" [%d]\n", (int)(_opcodes.count() - oldCount));
+	decodeTimer.Stop();
+	AddCount(COUNT_OPCODES, _opcodes.count() - oldCount);
+
+	if(_opcodes.count() != _linkedOpcodes) LinkOpcodes(oldCount, threads);
+	else LinkNewSlots();
+}
 
-		chk->opcodes.push_back(opc);
-		chk->size += opc->size;
-		opc->parent = chk;
+/*
+Link opcodes after a decode batch.
 
-		if(prevOpc)
+Opcodes before oldCount are already sorted by offset, and the new ones are
+appended after them. Merge both to sort the whole table again, so that
+handle == rank of offset. Then pointers, fall-through links and chunks are
+rebuilt with a linear scan over the decoded offsets.
+*/
+void IScript::LinkOpcodes(size_t oldCount, unsigned threads) const
+{
+	PhaseTimer linkTimer(PHASE_LINK);
+	size_t opcn = _opcodes.count();
+	const ArenaVector<uint16_t>& offset = _opcodes.offset;
+
+	std::vector<OpcodeHandle> order(opcn);
+	for(size_t i = 0; i < opcn; i++) order[i] = i;
+	std::sort(order.begin() + oldCount, order.end(),
+		[&](OpcodeHandle a, OpcodeHandle b) { return offset[a] < offset[b]; });
+	std::inplace_merge(order.begin(), order.begin() + oldCount, order.end(),
+		[&](OpcodeHandle a, OpcodeHandle b) { return offset[a] < offset[b]; });
+
+	Permute(_opcodes.type, order);
+	Permute(_opcodes.size, order);
+	Permute(_opcodes.offset, order);
+	Permute(_opcodes.argOffset, order);
+	Permute(_opcodes.targetOffset, order);
+	_opcodeIndex.BuildRank();
+
+	// Link pointers & next opcodes, then split into chunks. Chunk IDs are
+	// a prefix sum of chunk starts, so each pass works on its own range of
+	// opcodes and only a short serial step runs between them.
+	unsigned rangen = std::max(1u, std::min(threads, (unsigned)(opcn / 4096)));
+	struct RangeInfo
+	{
+		uint32_t chunkStarts;
+		uint32_t bytesAfterLastStart;  // Or whole range without any start.
+		uint32_t firstChunk;  // Chunk containing first opcode of the range.
+		uint32_t firstChunkPos;
+	};
+	std::vector<RangeInfo> ranges(rangen);
+
+	ParallelRanges(rangen, opcn, [&](unsigned r, size_t begin, size_t end)
+	{
+		RangeInfo& range = ranges[r];
+		range.chunkStarts = 0;
+		range.bytesAfterLastStart = 0;
+		for(OpcodeHandle opc = begin; opc < end; opc++)
 		{
-			opc->prev = prevOpc;
-			prevOpc->next = opc;
+			_opcodes.target[opc] = _opcodes.argOffset[opc] ?
+				_opcodeIndex.Find(_opcodes.targetOffset[opc]) : NO_OPCODE;
+
+			if(IsTerminator(_opcodes.type[opc])) _opcodes.next[opc] = NO_OPCODE;
+			else
+			{
+				OpcodeHandle next = _opcodeIndex.Find(offset[opc] + _opcodes.size[opc]);
+				if(next != opc + 1)  // Something got decoded inside the opcode.
+				{
+					FatalError("Overlapping opcodes at %d.",
+						offset[opc] + _opcodes.size[opc]);
+				}
+				_opcodes.next[opc] = next;
+			}
+
+			// Every non-terminator falls through to the next handle, so a
+			// chunk starts right after each terminator.
+			if(opc == 0 || IsTerminator(_opcodes.type[opc - 1]))
+			{
+				range.chunkStarts++;
+				range.bytesAfterLastStart = 0;
+			}
+			range.bytesAfterLastStart += _opcodes.size[opc];
 		}
+	});
 
-		uint8_t opcodeType = opc->plaindata[0];
-		if(!(
-			opcodeType == 0x07 ||  // goto
-			opcodeType == 0x16 ||  // end
-			opcodeType == 0x36     // return
-			))
+	uint32_t chunkn = 0, carryPos = 0;
+	for(RangeInfo& range : ranges)
+	{
+		range.firstChunk = chunkn - 1;  // Ignored if range starts a chunk.
+		range.firstChunkPos = carryPos;
+		chunkn += range.chunkStarts;
+		carryPos = range.chunkStarts ?
+			range.bytesAfterLastStart : carryPos + range.bytesAfterLastStart;
+	}
+
+	OpcodeChunk emptyChunk;
+	emptyChunk.first = 0;
+	emptyChunk.count = 0;
+	emptyChunk.size = 0;
+	emptyChunk.allocated_offset = 0xFFFF;
+	_chunks.assign(chunkn, emptyChunk);
+
+	ParallelRanges(rangen, opcn, [&](unsigned r, size_t begin, size_t end)
+	{
+		uint32_t chkID = ranges[r].firstChunk;
+		uint32_t pos = ranges[r].firstChunkPos;
+		for(OpcodeHandle opc = begin; opc < end; opc++)
 		{
-			prevOpc = opc;
+			if(opc == 0 || IsTerminator(_opcodes.type[opc - 1]))  // Chunk starts here
+			{
+				chkID++;
+				pos = 0;
+				_chunks[chkID].first = opc;
+			}
+			_opcodes.chunk[opc] = chkID;
+			_opcodes.chunkPos[opc] = pos;
+			pos += _opcodes.size[opc];
 		}
-		else
+	});
+
+	ParallelRanges(rangen, chunkn, [&](unsigned, size_t begin, size_t end)
+	{
+		for(size_t chkID = begin; chkID < end; chkID++)
 		{
-			prevOpc = nullptr;
-			chk = nullptr;
+			OpcodeChunk& chk = _chunks[chkID];
+			OpcodeHandle last = (chkID + 1 < chunkn ? _chunks[chkID + 1].first : opcn) - 1;
+			chk.count = last - chk.first + 1;
+			chk.size = _opcodes.chunkPos[last] + _opcodes.size[last];
 		}
-		
-		off += opc->size;
-	}
+	});
 
-	for(int off = 0; off < 65536; off++)
+	_linkedSlots = 0;
+	LinkNewSlots();
+	_linkedOpcodes = opcn;
+	_generation++;
+}
+
+/*
+Resolve slots of entries indexed since the last link. Enough when they
+reach only decoded code : handles, chunks and memos all stay valid.
+*/
+void IScript::LinkNewSlots() const
+{
+	for(size_t i = _linkedSlots; i < _entrySlots.size(); i++)
 	{
-		Opcode* opc = opcodeMap[off];
+		uint16_t slotOffset = _entrySlotOffsets[i];
+		_entrySlots[i] = slotOffset ? _opcodeIndex.Find(slotOffset) : NO_OPCODE;
 	}
-
-	printf("Iscript reading complete!\n");
-	printf(" - Total number of iscript chunks : %d\n", chkn);
+	_linkedSlots = _entrySlots.size();
 }
 
 IScriptEntry* IScript::GetEntry(uint16_t entryID)
 {
-	return _entries[entryID];
+	const IScript* cthis = this;
+	return const_cast<IScriptEntry*>(cthis->GetEntry(entryID));
 }
 
 const IScriptEntry* IScript::GetEntry(uint16_t entryID) const
 {
-	return _entries.find(entryID)->second;
+	auto it = _entries.find(entryID);
+	if(it != _entries.end()) return &it->second;
+	if(_entryOffsets.find(entryID) == _entryOffsets.end()) return nullptr;
+
+	// Decode on demand.
+	std::stack<uint16_t> opcodeParseStartOffsets;
+	IScriptEntry* isce = IndexEntry(entryID, opcodeParseStartOffsets);
+	DecodeOpcodes(opcodeParseStartOffsets);
+	return isce;
+}
+
+void IScript::DecodeEntries(const std::vector<uint16_t>& entryIDs) const
+{
+	std::stack<uint16_t> opcodeParseStartOffsets;
+	for(uint16_t entryID : entryIDs)
+	{
+		if(_entries.find(entryID) != _entries.end()) continue;
+		if(_entryOffsets.find(entryID) == _entryOffsets.end()) continue;
+		IndexEntry(entryID, opcodeParseStartOffsets);
+	}
+	DecodeOpcodes(opcodeParseStartOffsets);
 }
 
 std::vector<uint16_t> IScript::EnumEntries() const
 {
 	std::vector<uint16_t> entryIDSet;
-	for(auto& it : _entries) entryIDSet.push_back(it.first);
+	for(auto& it : _entryOffsets) entryIDSet.push_back(it.first);
 	return entryIDSet;
 }
 
-void IScript::UpdateDependency(uint16_t entryID, IScriptDependency* isd) const
+/*
+Chunks are emitted as a whole, so every pointer of a reached chunk counts.
+Closure of an entry is the union of reachable sets of chunks its slots
+point into; ChunkGraph memoizes those per strongly connected component.
+*/
+const ChunkSet& IScript::GetEntryDependency(uint16_t entryID) const
 {
-	std::stack<Opcode*> opcStack;
 	const IScriptEntry* entry = GetEntry(entryID);
-	for(Opcode* opcode : entry->opcodelist)
+
+	if(_chunkGraphGeneration != _generation)
 	{
-		opcStack.push(opcode);
+		_chunkGraph.Build(_opcodes, _chunks.data(), _chunks.size());
+		_entryDependency.clear();
+		_chunkGraphGeneration = _generation;
 	}
 
-	while(!opcStack.empty())
+	auto it = _entryDependency.find(entryID);
+	if(it != _entryDependency.end()) return it->second;
+
+	ChunkSet& entryDep = _entryDependency[entryID];
+	for(uint32_t i = 0; i < entry->count; i++)
 	{
-		Opcode* opcode = opcStack.top();
-		opcStack.pop();
-		if(opcode == nullptr) continue;
-		else if(isd->opcSet.find(opcode) != isd->opcSet.end()) continue;
+		OpcodeHandle opc = _entrySlots[entry->first + i];
+		if(opc != NO_OPCODE) entryDep |= _chunkGraph.GetReachable(_opcodes.chunk[opc]);
+	}
+	return entryDep;
+}
 
-		opcStack.push(opcode->next);
-		opcStack.push(opcode->pointer.ptr);
+void IScript::UpdateDependency(uint16_t entryID, IScriptDependency* isd) const
+{
+	const ChunkSet& entryDep = GetEntryDependency(entryID);
 
-		isd->opcSet.insert(opcode);
-		isd->chkSet.insert(opcode->parent);
+	if(isd->generation != _generation)
+	{
+		// Chunks got renumbered. Recollect from entries.
+		std::vector<uint16_t> entries;
+		entries.swap(isd->entries);
+		isd->chkSet.Clear();
+		isd->generation = _generation;
+		for(uint16_t prevEntryID : entries) UpdateDependency(prevEntryID, isd);
 	}
+
+	isd->entries.push_back(entryID);
+	isd->chkSet |= entryDep;
 }
 
-IScript::~IScript()
+uint64_t IScript::GetEntryHash(uint16_t entryID) const
 {
-	IScriptDependency isd;
+	const IScriptEntry* entry = GetEntry(entryID);
 
-	// Collect opcodes & chunks
-	for(auto& it : _entries)
+	if(_hasherGeneration != _generation)
 	{
-		UpdateDependency(it.first, &isd);
-		delete it.second;
+		_hasher.Reset(&_opcodes, _chunks.data(), _chunks.size(), _data);
+		_entryHash.clear();
+		_hasherGeneration = _generation;
 	}
 
-	for(Opcode* opc : isd.opcSet) delete opc;
-	for(OpcodeChunk* opcChk : isd.chkSet) delete opcChk;
+	auto it = _entryHash.find(entryID);
+	if(it != _entryHash.end()) return it->second;
+
+	uint64_t entryHash = _hasher.HashGraph(
+		((uint64_t)entry->type << 32) | entry->count,
+		_entrySlots.data() + entry->first,
+		entry->count);
+	_entryHash[entryID] = entryHash;
+	return entryHash;
 }
@@ -7,36 +7,165 @@
 
 #include <map>
 #include <set>
+#include <stack>
+#include <string>
 #include <vector>
-#include <istream>
 
+#include "arena.h"
 #include "iscript_opcode.h"
+#include "offsetindex.h"
+#include "chunkset.h"
+#include "chunkgraph.h"
+#include "structhash.h"
 
+struct SourceEdit;
+
+// Entry type -> number of opcode slots its header has.
+extern std::map<uint32_t, uint32_t> entryType_opcodeNum_map;
+
+/*
+Entry has 'count' opcode slots, stored in IScript slot arrays starting at
+'first'. Empty slots hold NO_OPCODE.
+*/
 struct IScriptEntry
 {
 	uint8_t type;
-	std::vector<Opcode*> opcodelist;
+	uint32_t first;
+	uint32_t count;
 };
 
+/*
+Set of chunks some entries need. Chunk IDs are ordered by source offset.
+Lazy decoding may renumber chunks : then the set is rebuilt from entries
+on next UpdateDependency.
+*/
 struct IScriptDependency
 {
-	std::set<Opcode*> opcSet;
-	std::set<OpcodeChunk*> chkSet;
+	IScriptDependency() : generation(0) {}
+
+	std::vector<uint16_t> entries;
+	ChunkSet chkSet;
+	unsigned generation;
 };
 
 class IScript
 {
 public:
-	IScript(std::istream& is);
-	~IScript();
+	// Decode iscript inside data. Decoded opcodes reference data directly,
+	// so the buffer should outlive IScript.
+	// With lazy set, only the entry table is read here. Entries and opcodes
+	// they reach are decoded when GetEntry or UpdateDependency first asks.
+	// decodeThreads > 1 decodes all entries on that many threads, with
+	// work stealing; lazy batches are small and stay single-threaded.
+	IScript(
+		const uint8_t* data, size_t size,
+		bool lazy = false, unsigned decodeThreads = 1);
 
 	std::vector<uint16_t> EnumEntries() const;
+	// Decode entries in one batch. A batch reaching only decoded code just
+	// resolves its slots. One reaching new code relinks the whole opcode
+	// table and drops every memo, so GetEntry decoding many entries one by
+	// one is quadratic : callers needing many should batch them here.
+	void DecodeEntries(const std::vector<uint16_t>& entryIDs) const;
 	IScriptEntry* GetEntry(uint16_t entryID);
 	const IScriptEntry* GetEntry(uint16_t entryID) const;
 	void UpdateDependency(uint16_t entryID, IScriptDependency* isd) const;
 
+	// Chunks entry needs, memoized. Valid until the next on-demand decode.
+	const ChunkSet& GetEntryDependency(uint16_t entryID) const;
+
+	// Structural hash of entry type and the opcode graph it reaches. Same
+	// for entries with the same content, wherever their opcodes are
+	// placed. Memoized like GetEntryDependency.
+	uint64_t GetEntryHash(uint16_t entryID) const;
+
+	// Write whole decoded model, decoding what isn't yet, to fname. See
+	// iscriptmodel.h.
+	bool SaveModel(const std::string& fname) const;
+	// Take decoded model from a file SaveModel wrote for the same data,
+	// instead of decoding. Works only on a lazy IScript nothing has been
+	// decoded from yet. Returns false, loading nothing, if model is broken
+	// or from other data.
+	bool LoadModel(const uint8_t* model, size_t modelSize);
+
+	// Take over what prev, decoding an earlier version of this data, has
+	// decoded. edits turn data of prev into this one, see iscriptdiff.h.
+	// Entries prev decoded are decoded here too, but only code inside or
+	// newly reached past edits is actually decoded. Works only on a lazy
+	// IScript nothing has been decoded from yet. Throws like decoding on
+	// overlaps it can't sort out : a fresh IScript decodes those fine.
+	// Returns number of opcodes taken over.
+	size_t ReuseDecoded(const IScript& prev, const std::vector<SourceEdit>& edits);
+
+	// Decoded opcode graph. In lazy mode, handles & chunk IDs are valid
+	// until the next on-demand decode.
+	const OpcodeTable& GetOpcodes() const { return _opcodes; }
+	const uint8_t* GetOpcodeData(OpcodeHandle opc) const
+	{
+		return _data + _opcodes.offset[opc];
+	}
+	OpcodeHandle GetEntryOpcode(const IScriptEntry* entry, int slot) const
+	{
+		return _entrySlots[entry->first + slot];
+	}
+
+	size_t GetChunkCount() const { return _chunks.size(); }
+	OpcodeChunk& GetChunk(uint32_t chkID) { return _chunks[chkID]; }
+	const OpcodeChunk& GetChunk(uint32_t chkID) const { return _chunks[chkID]; }
+
+	// Memory held by the decoded model.
+	size_t GetArenaBytes() const { return _arena.GetBytesReserved(); }
+	size_t GetArenaBlocks() const { return _arena.GetBlockCount(); }
+
+	// Final offset of opcode, from allocated offset of its chunk.
+	uint16_t GetAllocatedOffset(OpcodeHandle opc) const
+	{
+		return _chunks[_opcodes.chunk[opc]].allocated_offset +
+			_opcodes.chunkPos[opc];
+	}
+
 private:
-	std::map<uint16_t, IScriptEntry*> _entries;
+	IScriptEntry* IndexEntry(
+		uint16_t entryID,
+		std::stack<uint16_t>& opcodeParseStartOffsets) const;
+	void DecodeOpcodes(std::stack<uint16_t>& opcodeParseStartOffsets) const;
+	void DecodeOpcodesParallel(
+		std::stack<uint16_t>& opcodeParseStartOffsets,
+		unsigned threads) const;
+	void LinkOpcodes(size_t oldCount, unsigned threads) const;
+	void LinkNewSlots() const;
+
+	IScript(const IScript&);
+	IScript& operator=(const IScript&);
+
+	// Owns decoded model below. Declared first so that it is freed last,
+	// in one go.
+	mutable Arena _arena;
+
+	const uint8_t* _data;
+	size_t _size;
+	ArenaMap<uint16_t, uint16_t> _entryOffsets;
+
+	// Decoding state. Lazy mode fills these from const accessors.
+	mutable ArenaMap<uint16_t, IScriptEntry> _entries;
+	mutable ArenaVector<uint16_t> _entrySlotOffsets;
+	mutable ArenaVector<OpcodeHandle> _entrySlots;
+	mutable OffsetIndex _opcodeIndex;
+	mutable OpcodeTable _opcodes;
+	mutable ArenaVector<OpcodeChunk> _chunks;
+	mutable unsigned _generation;
+	// Opcodes & slots covered by the last link. Rows past these are new.
+	mutable size_t _linkedOpcodes;
+	mutable size_t _linkedSlots;
+
+	// Dependency state, rebuilt when _generation changes. This is a cache
+	// thrown away on every rebuild, so it stays on the heap.
+	mutable ChunkGraph _chunkGraph;
+	mutable unsigned _chunkGraphGeneration;
+	mutable std::map<uint16_t, ChunkSet> _entryDependency;
+	mutable StructuralHasher _hasher;
+	mutable unsigned _hasherGeneration;
+	mutable std::map<uint16_t, uint64_t> _entryHash;
 };
 
 #endif
@@ -7,10 +7,10 @@ Opcode structure for iscript.
 #ifndef ISCIRPT_OPCODE_HEADER_
 #define ISCIRPT_OPCODE_HEADER_
 
+#include <cstddef>
 #include <cstdint>
-#include <vector>
 
-#include "memorypool.h"
+#include "arena.h"
 
 /*
 Every iscript opcode consists of
@@ -19,45 +19,78 @@ Every iscript opcode consists of
 
 Data may have pointers (offset value) inside.
 
-Opcode may have explicit 'previous' or 'next' opcode.
+Opcode may have explicit 'next' opcode, which follows it in the file and
+gets executed after it.
 
- A  ->                 A.next = B
- B  -> B.prev = A      B.next = C
- C  -> C.prev = B
+ A  -> A.next = B
+ B  -> B.next = C
+ C
 */
 
-struct Opcode;
-struct OpcodeChunk;
+// Opcodes, chunks and entries refer each other by 32-bit handles.
+typedef uint32_t OpcodeHandle;
+const OpcodeHandle NO_OPCODE = 0xFFFFFFFF;
 
-struct PtrArg  // Reference to other pointer
-{
-	Opcode* ptr;
-	uint16_t arg_offset;  // Offset of ptrarg inside opcode
-	// length of file offset is always 2byte.
-};
+/*
+Opcodes are stored as struct-of-arrays. Row i of every column describes
+opcode with handle i. Opcode bytes aren't copied : they are read from the
+source buffer at offset[i].
+
+Once linked, rows are sorted by source offset, so opcodes of a chunk have
+consecutive handles. Columns are allocated from the arena of owning IScript.
+*/
 
-struct Opcode : public MemoryPooled
+struct OpcodeTable
 {
-	OpcodeChunk* parent;
+	explicit OpcodeTable(Arena* arena)
+		: type(ArenaAllocator<uint8_t>(arena)),
+		size(ArenaAllocator<uint16_t>(arena)),
+		offset(ArenaAllocator<uint16_t>(arena)),
+		argOffset(ArenaAllocator<uint8_t>(arena)),
+		targetOffset(ArenaAllocator<uint16_t>(arena)),
+		target(ArenaAllocator<OpcodeHandle>(arena)),
+		next(ArenaAllocator<OpcodeHandle>(arena)),
+		chunk(ArenaAllocator<uint32_t>(arena)),
+		chunkPos(ArenaAllocator<uint16_t>(arena))
+	{
+	}
+
+	ArenaVector<uint8_t> type;
+	ArenaVector<uint16_t> size;
+	ArenaVector<uint16_t> offset;  // Source offset.
+	ArenaVector<uint8_t> argOffset;  // Offset of ptrarg inside opcode, 0 if none.
+	ArenaVector<uint16_t> targetOffset;  // Raw source offset ptrarg points to.
+	ArenaVector<OpcodeHandle> target;  // Opcode ptrarg points to.
+	ArenaVector<OpcodeHandle> next;  // Fall-through opcode.
+	ArenaVector<uint32_t> chunk;  // Chunk containing the opcode.
+	ArenaVector<uint16_t> chunkPos;  // Byte position inside the chunk.
+
+	size_t count() const { return type.size(); }
+};
 
-	Opcode *prev, *next;  // Previous & Next opcode according to file.
-	uint16_t size;
-	std::vector<uint8_t> plaindata;  // opcode type + plain datas all combined
-	PtrArg pointer;
+/*
+Decode opcode at given offset of source buffer and append it to table.
+Every read is bounds-checked against size. target, next, chunk and
+chunkPos are left unlinked.
+*/
+OpcodeHandle GetOpcode(
+	const uint8_t* data, size_t size, uint16_t offset, OpcodeTable* table);
 
-	uint16_t allocated_offset;  // Where opcode is allocated.
-};
+bool IsTerminator(uint8_t opcodeType);
 
 /*
 Several opcodes may join together to make a 'chunk'. Opcodes inside chunk
 operates within them. Chunks can be shuffled as they wish.
 
-Final opcode offsets are allocated by its belonging chunks.
+Chunk is a range of opcode handles [first, first + count). Its bytes are
+contiguous in the source buffer too. Final opcode offsets are allocated by
+its belonging chunks.
 */
 
 struct OpcodeChunk
 {
-	std::vector<Opcode*> opcodes;
+	OpcodeHandle first;
+	uint32_t count;
 	uint16_t size;
 	uint16_t allocated_offset;
 };
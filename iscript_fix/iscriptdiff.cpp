@@ -0,0 +1,196 @@
+#include <cstring>
+
+#include <algorithm>
+#include <exception>
+#include <stack>
+
+#include "instrument.h"
+#include "iscript.h"
+#include "iscriptdiff.h"
+
+std::vector<SourceEdit> DiffSources(
+	const uint8_t* oldData, size_t oldSize,
+	const uint8_t* newData, size_t newSize)
+{
+	std::vector<SourceEdit> edits;
+	size_t common = std::min(oldSize, newSize);
+	if(oldSize == newSize)
+	{
+		for(size_t i = 0; i < common;)
+		{
+			if(oldData[i] == newData[i]) { i++; continue; }
+			SourceEdit edit = { (uint32_t)i, 0, 0 };
+			while(i < common && oldData[i] != newData[i]) i++;
+			edit.oldSize = edit.newSize = (uint32_t)(i - edit.offset);
+			edits.push_back(edit);
+		}
+		return edits;
+	}
+
+	size_t prefix = 0, suffix = 0;
+	while(prefix < common && oldData[prefix] == newData[prefix]) prefix++;
+	while(suffix < common - prefix &&
+		oldData[oldSize - 1 - suffix] == newData[newSize - 1 - suffix]) suffix++;
+	SourceEdit edit =
+	{
+		(uint32_t)prefix,
+		(uint32_t)(oldSize - prefix - suffix),
+		(uint32_t)(newSize - prefix - suffix)
+	};
+	edits.push_back(edit);
+	return edits;
+}
+
+template<typename T>
+static void KeepRows(ArenaVector<T>& column, const std::vector<bool>& keep)
+{
+	size_t kept = 0;
+	for(size_t i = 0; i < column.size(); i++)
+	{
+		if(keep[i]) column[kept++] = column[i];
+	}
+	column.resize(kept);
+}
+
+/*
+An opcode decodes from its own bytes only. So wherever prev has decoded
+an opcode whose bytes are left alone by every edit, this data holds the
+same opcode at the moved offset, and its row is copied instead of
+decoding it. Only rows in chunks prev entries still reach are taken, so
+code an earlier edit cut off doesn't pile up.
+
+Rows are copied in offset order and edits only ever move them as a
+block, so the table stays sorted. Whatever copied rows point or fall
+through to that didn't make it, plus slots of the entries, is then
+decoded as usual. A copied row that turns out to overlap code decoded
+from there fails like any overlap : callers decode from scratch then.
+
+Rows the edits cut off are dropped at the end. Left alone, one falling
+through into live code would join its chunk and get emitted with it, so
+output would differ from decoding from scratch.
+*/
+size_t IScript::ReuseDecoded(const IScript& prev, const std::vector<SourceEdit>& edits)
+{
+	if(!_entries.empty()) return 0;
+
+	std::stack<uint16_t> opcodeParseStartOffsets;
+	ChunkSet liveChunks;
+	for(auto& it : prev._entries)
+	{
+		if(_entryOffsets.find(it.first) == _entryOffsets.end()) continue;
+		IndexEntry(it.first, opcodeParseStartOffsets);
+		liveChunks |= prev.GetEntryDependency(it.first);
+	}
+
+	const OpcodeTable& prevOpcodes = prev._opcodes;
+	size_t editIndex = 0;
+	int64_t shift = 0;
+	liveChunks.ForEach([&](uint32_t chkID)
+	{
+		const OpcodeChunk& chk = prev._chunks[chkID];
+		for(OpcodeHandle opc = chk.first; opc < chk.first + chk.count; opc++)
+		{
+			uint32_t begin = prevOpcodes.offset[opc];
+			uint32_t end = begin + prevOpcodes.size[opc];
+			while(editIndex < edits.size() &&
+				edits[editIndex].offset + edits[editIndex].oldSize <= begin)
+			{
+				shift += (int64_t)edits[editIndex].newSize - edits[editIndex].oldSize;
+				editIndex++;
+			}
+			if(editIndex < edits.size() && edits[editIndex].offset < end &&
+				edits[editIndex].offset + edits[editIndex].oldSize > begin) continue;
+
+			// Bytes are checked anyway, so wrong edits cost speed, not results.
+			int64_t moved = begin + shift;
+			if(moved < 0 || moved + prevOpcodes.size[opc] > (int64_t)_size ||
+				moved > 0xFFFF) continue;
+			if(memcmp(prev._data + begin, _data + moved, prevOpcodes.size[opc]) != 0) continue;
+
+			_opcodes.type.push_back(prevOpcodes.type[opc]);
+			_opcodes.size.push_back(prevOpcodes.size[opc]);
+			_opcodes.offset.push_back((uint16_t)moved);
+			_opcodes.argOffset.push_back(prevOpcodes.argOffset[opc]);
+			_opcodes.targetOffset.push_back(prevOpcodes.targetOffset[opc]);
+			_opcodes.target.push_back(NO_OPCODE);
+			_opcodes.next.push_back(NO_OPCODE);
+			_opcodes.chunk.push_back(0);
+			_opcodes.chunkPos.push_back(0);
+			_opcodeIndex.Insert((uint16_t)moved);
+		}
+	});
+	size_t reused = _opcodes.count();
+
+	for(OpcodeHandle opc = 0; opc < reused; opc++)
+	{
+		if(_opcodes.argOffset[opc] && !_opcodeIndex.Contains(_opcodes.targetOffset[opc]))
+		{
+			opcodeParseStartOffsets.push(_opcodes.targetOffset[opc]);
+		}
+		uint16_t nextOffset = _opcodes.offset[opc] + _opcodes.size[opc];
+		if(!IsTerminator(_opcodes.type[opc]) && !_opcodeIndex.Contains(nextOffset))
+		{
+			opcodeParseStartOffsets.push(nextOffset);
+		}
+	}
+
+	// Copied rows aren't linked yet, so this links them even if nothing
+	// new gets decoded.
+	DecodeOpcodes(opcodeParseStartOffsets);
+
+	size_t opcn = _opcodes.count();
+	std::vector<bool> reached(opcn, false);
+	std::vector<OpcodeHandle> pending(_entrySlots.begin(), _entrySlots.end());
+	size_t reachedCount = 0;
+	while(!pending.empty())
+	{
+		OpcodeHandle opc = pending.back();
+		pending.pop_back();
+		if(opc == NO_OPCODE || reached[opc]) continue;
+		reached[opc] = true;
+		reachedCount++;
+		pending.push_back(_opcodes.next[opc]);
+		pending.push_back(_opcodes.target[opc]);
+	}
+	if(reachedCount == opcn) return reused;
+
+	KeepRows(_opcodes.type, reached);
+	KeepRows(_opcodes.size, reached);
+	KeepRows(_opcodes.offset, reached);
+	KeepRows(_opcodes.argOffset, reached);
+	KeepRows(_opcodes.targetOffset, reached);
+	KeepRows(_opcodes.target, reached);
+	KeepRows(_opcodes.next, reached);
+	KeepRows(_opcodes.chunk, reached);
+	KeepRows(_opcodes.chunkPos, reached);
+	_opcodeIndex = OffsetIndex();
+	for(uint16_t offset : _opcodes.offset) _opcodeIndex.Insert(offset);
+	LinkOpcodes(reachedCount, 1);
+	return reused;
+}
+
+std::unique_ptr<IScript> ReadEditedIScript(
+	const uint8_t* data, size_t size,
+	const IScript* prev, const uint8_t* prevData, size_t prevSize,
+	std::vector<SourceEdit>* edits)
+{
+	std::vector<SourceEdit> diff;
+	if(prev) diff = DiffSources(prevData, prevSize, data, size);
+	if(edits) *edits = diff;
+
+	std::unique_ptr<IScript> isc;
+	if(prev)
+	{
+		try
+		{
+			isc.reset(new IScript(data, size, true));
+			AddCount(COUNT_REUSED_OPCODES, isc->ReuseDecoded(*prev, diff));
+		}
+		catch(const std::exception&)
+		{
+			isc.reset();
+		}
+	}
+	if(!isc) isc.reset(new IScript(data, size, true));
+	return isc;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef ISCRIPTDIFF_HEADER_
+#define ISCRIPTDIFF_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class IScript;
+
+/*
+Bytes [offset, offset + oldSize) of a source, replaced by newSize bytes
+in its next version. Bytes past the edit move by newSize - oldSize.
+*/
+struct SourceEdit
+{
+	uint32_t offset;
+	uint32_t oldSize;
+	uint32_t newSize;
+};
+
+/*
+Edits turning oldData into newData, sorted by offset and not overlapping.
+Same-sized sources give one edit per run of differing bytes. Otherwise
+everything between the common prefix and suffix is a single edit. Empty
+when both are the same.
+*/
+std::vector<SourceEdit> DiffSources(
+	const uint8_t* oldData, size_t oldSize,
+	const uint8_t* newData, size_t newSize);
+
+/*
+Lazy IScript over data. With prev, decoded from prevData before, the
+opcodes edits left alone are taken over from prev. When they can't be,
+data is read from scratch instead. Edits are stored to edits if given.
+Throws only when data itself can't be read.
+*/
+std::unique_ptr<IScript> ReadEditedIScript(
+	const uint8_t* data, size_t size,
+	const IScript* prev, const uint8_t* prevData, size_t prevSize,
+	std::vector<SourceEdit>* edits = nullptr);
+
+#endif
@@ -0,0 +1,194 @@
+#include <cstring>
+
+#include <algorithm>
+
+#include "iscript.h"
+#include "iscriptmodel.h"
+#include "mappedfile.h"
+
+static const uint64_t SOURCE_HASH_SEED = 0xCBF29CE484222325ull;  // FNV offset basis
+
+template<typename T>
+static const T* GetSection(const uint8_t* model, const ModelHeader& header, ModelSection section)
+{
+	return (const T*)(model + header.sectionOffset[section]);
+}
+
+template<typename T, typename U>
+static bool AllBelow(const T* values, size_t count, U limit, T allowed)
+{
+	for(size_t i = 0; i < count; i++)
+	{
+		if(values[i] >= limit && values[i] != allowed) return false;
+	}
+	return true;
+}
+
+bool IScript::SaveModel(const std::string& fname) const
+{
+	DecodeEntries(EnumEntries());
+
+	ModelHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "ISCM", 4);
+	header.version = MODEL_VERSION;
+	header.sourceHash = HashBytes(_data, _size, SOURCE_HASH_SEED);
+	header.sourceSize = (uint32_t)_size;
+	header.entryCount = (uint32_t)_entries.size();
+	header.slotCount = (uint32_t)_entrySlots.size();
+	header.opcodeCount = (uint32_t)_opcodes.count();
+	header.chunkCount = (uint32_t)_chunks.size();
+	header.depWords = (header.chunkCount + 63) / 64;
+
+	std::vector<ModelEntry> entries;
+	std::vector<uint64_t> deps(header.entryCount * header.depWords, 0);
+	for(auto& it : _entries)
+	{
+		ModelEntry entry = { it.first, it.second.type, it.second.first, it.second.count };
+		const std::vector<uint64_t>& words = GetEntryDependency(it.first).GetWords();
+		size_t wordn = std::min(words.size(), (size_t)header.depWords);
+		std::copy(words.begin(), words.begin() + wordn, deps.begin() + entries.size() * header.depWords);
+		entries.push_back(entry);
+	}
+
+	std::vector<uint8_t> out(sizeof(header));
+	auto addSection = [&](ModelSection section, const void* p, size_t bytes)
+	{
+		out.resize((out.size() + 7) & ~(size_t)7);
+		header.sectionOffset[section] = (uint32_t)out.size();
+		out.insert(out.end(), (const uint8_t*)p, (const uint8_t*)p + bytes);
+	};
+	addSection(MODEL_ENTRIES, entries.data(), entries.size() * sizeof(ModelEntry));
+	addSection(MODEL_SLOT_OFFSETS, _entrySlotOffsets.data(), _entrySlotOffsets.size() * 2);
+	addSection(MODEL_SLOTS, _entrySlots.data(), _entrySlots.size() * 4);
+	size_t opcn = _opcodes.count();
+	addSection(MODEL_OP_TYPE, _opcodes.type.data(), opcn);
+	addSection(MODEL_OP_SIZE, _opcodes.size.data(), opcn * 2);
+	addSection(MODEL_OP_OFFSET, _opcodes.offset.data(), opcn * 2);
+	addSection(MODEL_OP_ARGOFFSET, _opcodes.argOffset.data(), opcn);
+	addSection(MODEL_OP_TARGETOFFSET, _opcodes.targetOffset.data(), opcn * 2);
+	addSection(MODEL_OP_TARGET, _opcodes.target.data(), opcn * 4);
+	addSection(MODEL_OP_NEXT, _opcodes.next.data(), opcn * 4);
+	addSection(MODEL_OP_CHUNK, _opcodes.chunk.data(), opcn * 4);
+	addSection(MODEL_OP_CHUNKPOS, _opcodes.chunkPos.data(), opcn * 2);
+	addSection(MODEL_CHUNKS, _chunks.data(), _chunks.size() * sizeof(OpcodeChunk));
+	addSection(MODEL_DEPS, deps.data(), deps.size() * 8);
+	header.bodyHash = HashBytes(
+		out.data() + sizeof(header), out.size() - sizeof(header), SOURCE_HASH_SEED);
+	memcpy(out.data(), &header, sizeof(header));
+
+	// Written aside and swapped in, so readers never map a partial model
+	// and concurrent savers never share a temp file.
+	MappedOutputFile file;
+	if(!file.Create(fname, out.size())) return false;
+	memcpy(file.data(), out.data(), out.size());
+	return file.Commit();
+}
+
+bool IScript::LoadModel(const uint8_t* model, size_t modelSize)
+{
+	if(!_entries.empty()) return false;
+
+	ModelHeader header;
+	if(modelSize < sizeof(header)) return false;
+	memcpy(&header, model, sizeof(header));
+	if(memcmp(header.magic, "ISCM", 4) != 0 || header.version != MODEL_VERSION) return false;
+	if(header.sourceSize != _size ||
+		header.sourceHash != HashBytes(_data, _size, SOURCE_HASH_SEED)) return false;
+	if(header.bodyHash != HashBytes(
+		model + sizeof(header), modelSize - sizeof(header), SOURCE_HASH_SEED)) return false;
+	if(header.entryCount != _entryOffsets.size() ||
+		header.depWords != (header.chunkCount + 63) / 64) return false;
+
+	// Every section should lie inside the file.
+	const size_t opcn = header.opcodeCount, chunkn = header.chunkCount;
+	const size_t rowSize[MODEL_SECTION_COUNT] =
+	{
+		sizeof(ModelEntry), 2, 4,
+		1, 2, 2, 1, 2, 4, 4, 4, 2,
+		sizeof(OpcodeChunk), 8 * (size_t)header.depWords,
+	};
+	const size_t rowCount[MODEL_SECTION_COUNT] =
+	{
+		header.entryCount, header.slotCount, header.slotCount,
+		opcn, opcn, opcn, opcn, opcn, opcn, opcn, opcn, opcn,
+		chunkn, header.entryCount,
+	};
+	for(int i = 0; i < MODEL_SECTION_COUNT; i++)
+	{
+		size_t offset = header.sectionOffset[i];
+		if((offset & 7) || offset < sizeof(header) || offset > modelSize) return false;
+		if(rowSize[i] && (modelSize - offset) / rowSize[i] < rowCount[i]) return false;
+	}
+
+	// Every reference should stay in range, so a broken model can't send
+	// later passes out of bounds.
+	const ModelEntry* entries = GetSection<ModelEntry>(model, header, MODEL_ENTRIES);
+	const uint16_t* slotOffsets = GetSection<uint16_t>(model, header, MODEL_SLOT_OFFSETS);
+	const OpcodeHandle* slots = GetSection<OpcodeHandle>(model, header, MODEL_SLOTS);
+	const uint8_t* type = GetSection<uint8_t>(model, header, MODEL_OP_TYPE);
+	const uint16_t* size = GetSection<uint16_t>(model, header, MODEL_OP_SIZE);
+	const uint16_t* offset = GetSection<uint16_t>(model, header, MODEL_OP_OFFSET);
+	const uint8_t* argOffset = GetSection<uint8_t>(model, header, MODEL_OP_ARGOFFSET);
+	const uint16_t* targetOffset = GetSection<uint16_t>(model, header, MODEL_OP_TARGETOFFSET);
+	const OpcodeHandle* target = GetSection<OpcodeHandle>(model, header, MODEL_OP_TARGET);
+	const OpcodeHandle* next = GetSection<OpcodeHandle>(model, header, MODEL_OP_NEXT);
+	const uint32_t* chunk = GetSection<uint32_t>(model, header, MODEL_OP_CHUNK);
+	const uint16_t* chunkPos = GetSection<uint16_t>(model, header, MODEL_OP_CHUNKPOS);
+	const OpcodeChunk* chunks = GetSection<OpcodeChunk>(model, header, MODEL_CHUNKS);
+	const uint64_t* deps = GetSection<uint64_t>(model, header, MODEL_DEPS);
+
+	for(uint32_t i = 0; i < header.entryCount; i++)
+	{
+		if(_entryOffsets.find(entries[i].id) == _entryOffsets.end()) return false;
+		if(entries[i].first > header.slotCount ||
+			entries[i].count > header.slotCount - entries[i].first) return false;
+	}
+	if(!AllBelow(slots, header.slotCount, opcn, NO_OPCODE)) return false;
+	if(!AllBelow(target, opcn, opcn, NO_OPCODE)) return false;
+	if(!AllBelow(next, opcn, opcn, NO_OPCODE)) return false;
+	for(size_t i = 0; i < opcn; i++)
+	{
+		if((size_t)offset[i] + size[i] > _size || chunk[i] >= chunkn) return false;
+		if(argOffset[i] && argOffset[i] + 2 > size[i]) return false;
+		if(i && offset[i] <= offset[i - 1]) return false;  // Sorted by offset
+	}
+	for(size_t i = 0; i < chunkn; i++)
+	{
+		if(chunks[i].first >= opcn || chunks[i].count > opcn - chunks[i].first) return false;
+	}
+
+	_entrySlotOffsets.assign(slotOffsets, slotOffsets + header.slotCount);
+	_entrySlots.assign(slots, slots + header.slotCount);
+	_opcodes.type.assign(type, type + opcn);
+	_opcodes.size.assign(size, size + opcn);
+	_opcodes.offset.assign(offset, offset + opcn);
+	_opcodes.argOffset.assign(argOffset, argOffset + opcn);
+	_opcodes.targetOffset.assign(targetOffset, targetOffset + opcn);
+	_opcodes.target.assign(target, target + opcn);
+	_opcodes.next.assign(next, next + opcn);
+	_opcodes.chunk.assign(chunk, chunk + opcn);
+	_opcodes.chunkPos.assign(chunkPos, chunkPos + opcn);
+	_chunks.assign(chunks, chunks + chunkn);
+	_linkedOpcodes = opcn;
+	_linkedSlots = header.slotCount;
+	for(size_t i = 0; i < opcn; i++) _opcodeIndex.Insert(offset[i]);
+	_opcodeIndex.BuildRank();
+
+	// Saved dependencies stand in for the chunk graph. Every entry has
+	// one, so the graph isn't needed until something gets decoded again.
+	_generation++;
+	_chunkGraphGeneration = _generation;
+	_entryDependency.clear();
+	for(uint32_t i = 0; i < header.entryCount; i++)
+	{
+		const ModelEntry& entry = entries[i];
+		IScriptEntry& isce = _entries[entry.id];
+		isce.type = (uint8_t)entry.type;
+		isce.first = entry.first;
+		isce.count = entry.count;
+		_entryDependency[entry.id].SetWords(
+			deps + i * header.depWords, header.depWords);
+	}
+	return true;
+}
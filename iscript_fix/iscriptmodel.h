@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef ISCRIPTMODEL_HEADER_
+#define ISCRIPTMODEL_HEADER_
+
+#include <cstdint>
+
+/*
+File format of decoded IScript models, as IScript::SaveModel writes them.
+
+Everything is little-endian and refers to other things by index, never by
+pointer : opcodes by handle, chunks by ID, slots by position. Header is
+followed by sections, each starting at an 8-byte aligned sectionOffset, so
+a mapped file can be read through typed pointers. Sections are :
+
+ - ENTRIES : entryCount ModelEntry, by ascending ID
+ - SLOT_OFFSETS, SLOTS : slotCount uint16_t source offsets & handles
+ - OP_* : one column of OpcodeTable each, opcodeCount rows
+ - CHUNKS : chunkCount OpcodeChunk
+ - DEPS : depWords uint64_t per entry, ChunkSet of chunks the entry needs
+
+Model belongs to the source whose size & hash are in header. Sections are
+hashed too, so a damaged file gets decoded over instead of trusted. Bump
+MODEL_VERSION whenever anything here or the decoder changes.
+*/
+
+const uint32_t MODEL_VERSION = 1;
+
+enum ModelSection
+{
+	MODEL_ENTRIES,
+	MODEL_SLOT_OFFSETS,
+	MODEL_SLOTS,
+	MODEL_OP_TYPE,
+	MODEL_OP_SIZE,
+	MODEL_OP_OFFSET,
+	MODEL_OP_ARGOFFSET,
+	MODEL_OP_TARGETOFFSET,
+	MODEL_OP_TARGET,
+	MODEL_OP_NEXT,
+	MODEL_OP_CHUNK,
+	MODEL_OP_CHUNKPOS,
+	MODEL_CHUNKS,
+	MODEL_DEPS,
+	MODEL_SECTION_COUNT
+};
+
+struct ModelHeader
+{
+	char magic[4];  // "ISCM"
+	uint32_t version;
+	uint64_t sourceHash;  // HashBytes(source, FNV offset basis)
+	uint64_t bodyHash;  // HashBytes of everything after header, same seed
+	uint32_t sourceSize;
+	uint32_t entryCount;
+	uint32_t slotCount;
+	uint32_t opcodeCount;
+	uint32_t chunkCount;
+	uint32_t depWords;
+	uint32_t sectionOffset[MODEL_SECTION_COUNT];
+};
+
+struct ModelEntry
+{
+	uint16_t id;
+	uint16_t type;
+	uint32_t first;
+	uint32_t count;
+};
+
+#endif
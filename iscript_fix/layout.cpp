@@ -0,0 +1,289 @@
+#include "layout.h"
+#include "iscript.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+
+static const uint32_t NO_OFFSET = 0xFFFFFFFF;
+static const uint32_t NO_CLASS = 0xFFFFFFFF;
+static const uint8_t GOTO = 0x07;
+static const uint32_t GOTO_SIZE = 3;
+
+void CodeLayout::Build(
+	const IScript& isc,
+	const std::vector<OpcodeHandle>& roots,
+	const ChunkSet& chunks,
+	const ChunkSet& fixed,
+	bool optimize)
+{
+	const OpcodeTable& opcodes = isc.GetOpcodes();
+	size_t opcn = opcodes.count();
+	_isc = &isc;
+	_fixed = &fixed;
+	_offset.assign(opcn, NO_OFFSET);
+	_pieces.clear();
+	_deadBytes = 0;
+	_mergedBytes = 0;
+	_threadedGotos = 0;
+	_gapBytes = 0;
+	_endOffset = 0;
+	_thread.clear();
+
+	if(optimize)
+	{
+		ThreadJumps();
+		MarkLive(roots);
+		ClassifyLive();
+	}
+	else
+	{
+		_live.assign(opcn, true);
+		_class.assign(opcn, NO_CLASS);
+		_classRep.clear();
+	}
+
+	chunks.ForEach([&](uint32_t chkID)
+	{
+		if(fixed.Test(chkID)) return;
+		const OpcodeChunk& chk = isc.GetChunk(chkID);
+		OpcodeHandle start = chk.first, end = chk.first + chk.count;
+		while(start < end && !_live[start])
+		{
+			_deadBytes += opcodes.size[start];
+			start++;
+		}
+		if(start == end) return;
+
+		CodePiece piece;
+		piece.first = start;
+		piece.count = 0;
+		piece.gotoTarget = NO_OPCODE;
+		piece.offset = 0;
+		piece.size = 0;
+		for(OpcodeHandle opc = start; opc < end; opc++)
+		{
+			uint32_t cls = _class[opc];
+			if(cls != NO_CLASS && _classRep[cls] != NO_OPCODE)  // Placed already
+			{
+				uint32_t rest = chk.size - opcodes.chunkPos[opc];
+				if(opc == start)
+				{
+					_mergedBytes += rest;
+					break;
+				}
+				if(rest > GOTO_SIZE)
+				{
+					piece.gotoTarget = _classRep[cls];
+					piece.size += GOTO_SIZE;
+					_mergedBytes += rest - GOTO_SIZE;
+					break;
+				}
+			}
+
+			_offset[opc] = piece.size;
+			if(cls != NO_CLASS && _classRep[cls] == NO_OPCODE) _classRep[cls] = opc;
+			piece.count++;
+			piece.size += opcodes.size[opc];
+		}
+
+		if(piece.size == 0) return;  // Merged as a whole
+		_pieces.push_back(piece);
+	});
+}
+
+void CodeLayout::Place(const std::vector<CodeGap>& gaps, uint32_t appendOffset)
+{
+	const uint32_t UNPLACED = 0xFFFFFFFF;
+	for(CodePiece& piece : _pieces) piece.offset = UNPLACED;
+
+	// Best fit, largest pieces first. Ties go by piece order so that
+	// output doesn't depend on sort implementation.
+	std::multimap<uint32_t, uint32_t> freeGaps;  // Size -> offset
+	for(const CodeGap& gap : gaps)
+	{
+		if(gap.size) freeGaps.insert(std::make_pair(gap.size, gap.offset));
+	}
+	if(!freeGaps.empty())
+	{
+		std::vector<size_t> order(_pieces.size());
+		for(size_t i = 0; i < order.size(); i++) order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+		{
+			return _pieces[a].size > _pieces[b].size;
+		});
+
+		for(size_t i : order)
+		{
+			CodePiece& piece = _pieces[i];
+			auto it = freeGaps.lower_bound(piece.size);
+			if(it == freeGaps.end()) continue;
+
+			uint32_t gapSize = it->first, gapOffset = it->second;
+			freeGaps.erase(it);
+			piece.offset = gapOffset;
+			_gapBytes += piece.size;
+			if(gapSize > piece.size)
+			{
+				freeGaps.insert(std::make_pair(
+					gapSize - piece.size, gapOffset + piece.size));
+			}
+		}
+	}
+
+	uint32_t pos = appendOffset;
+	for(CodePiece& piece : _pieces)
+	{
+		if(piece.offset == UNPLACED)
+		{
+			piece.offset = pos;
+			pos += piece.size;
+		}
+		for(OpcodeHandle opc = piece.first; opc < piece.first + piece.count; opc++)
+		{
+			_offset[opc] += piece.offset;
+		}
+	}
+	_endOffset = pos;
+}
+
+uint16_t CodeLayout::GetOffset(OpcodeHandle opc) const
+{
+	if(_fixed->Test(_isc->GetOpcodes().chunk[opc]))
+	{
+		return _isc->GetAllocatedOffset(opc);
+	}
+
+	// Opcodes not placed themselves run as placed one of their class.
+	uint32_t offset = _offset[opc];
+	if(offset == NO_OFFSET) offset = _offset[_classRep[_class[opc]]];
+	return offset;
+}
+
+/*
+Find where each goto chain ends. A goto into a chain of gotos ending on
+some other opcode gets threaded to that opcode. Gotos looping among
+themselves are left alone.
+*/
+void CodeLayout::ThreadJumps()
+{
+	const OpcodeTable& opcodes = _isc->GetOpcodes();
+	size_t opcn = opcodes.count();
+	_thread.resize(opcn);
+	for(OpcodeHandle opc = 0; opc < opcn; opc++) _thread[opc] = opc;
+
+	std::vector<bool> resolved(opcn, false);
+	std::vector<bool> onPath(opcn, false);
+	std::vector<OpcodeHandle> path;
+	for(OpcodeHandle opc = 0; opc < opcn; opc++)
+	{
+		if(resolved[opc] || opcodes.type[opc] != GOTO) continue;
+
+		// Walk the chain until a non-goto, a resolved goto or a loop.
+		OpcodeHandle cur = opc;
+		while(opcodes.type[cur] == GOTO && !resolved[cur] && !onPath[cur])
+		{
+			onPath[cur] = true;
+			path.push_back(cur);
+			cur = opcodes.target[cur];
+		}
+
+		OpcodeHandle end;
+		if(onPath[cur]) end = NO_OPCODE;  // Loop of gotos
+		else end = resolved[cur] ? _thread[cur] : cur;
+
+		for(OpcodeHandle g : path)
+		{
+			if(end != NO_OPCODE) _thread[g] = end;
+			resolved[g] = true;
+			onPath[g] = false;
+		}
+		path.clear();
+	}
+}
+
+OpcodeHandle CodeLayout::GetTarget(OpcodeHandle opc) const
+{
+	return Thread(_isc->GetOpcodes().target[opc]);
+}
+
+void CodeLayout::MarkLive(const std::vector<OpcodeHandle>& roots)
+{
+	const OpcodeTable& opcodes = _isc->GetOpcodes();
+	_live.assign(opcodes.count(), false);
+
+	std::vector<OpcodeHandle> stack;
+	for(OpcodeHandle root : roots) stack.push_back(Thread(root));
+	while(!stack.empty())
+	{
+		OpcodeHandle opc = stack.back();
+		stack.pop_back();
+		if(opc == NO_OPCODE || _live[opc]) continue;
+		if(_fixed->Test(opcodes.chunk[opc])) continue;
+
+		_live[opc] = true;
+		OpcodeHandle target = opcodes.target[opc];
+		if(target != NO_OPCODE && Thread(target) != target) _threadedGotos++;
+		stack.push_back(Thread(target));
+		stack.push_back(opcodes.next[opc]);
+	}
+}
+
+uint64_t CodeLayout::ClassOf(OpcodeHandle opc) const
+{
+	if(opc == NO_OPCODE) return ~(uint64_t)0;
+	if(!_live[opc]) return ((uint64_t)1 << 32) | opc;  // Fixed : only itself
+	return _class[opc];
+}
+
+/*
+Moore-style partition refinement. Opcodes start grouped by their bytes
+with pointer field cleared, then get split by classes of their pointer
+target & next opcode until the number of classes stops growing.
+*/
+void CodeLayout::ClassifyLive()
+{
+	const OpcodeTable& opcodes = _isc->GetOpcodes();
+	_class.assign(opcodes.count(), NO_CLASS);
+
+	std::vector<OpcodeHandle> live;
+	for(OpcodeHandle opc = 0; opc < opcodes.count(); opc++)
+	{
+		if(_live[opc]) live.push_back(opc);
+	}
+
+	std::map<std::string, uint32_t> byteClass;
+	for(OpcodeHandle opc : live)
+	{
+		std::string key((const char*)_isc->GetOpcodeData(opc), opcodes.size[opc]);
+		uint8_t ptrPos = opcodes.argOffset[opc];
+		if(ptrPos) key[ptrPos] = key[ptrPos + 1] = 0;
+		_class[opc] = byteClass.insert(
+			std::make_pair(key, (uint32_t)byteClass.size())).first->second;
+	}
+
+	size_t classCount = byteClass.size();
+	std::vector<uint32_t> newClass(live.size());
+	while(1)
+	{
+		std::map<std::tuple<uint32_t, uint64_t, uint64_t>, uint32_t> refined;
+		for(size_t i = 0; i < live.size(); i++)
+		{
+			OpcodeHandle opc = live[i];
+			auto key = std::make_tuple(
+				_class[opc],
+				ClassOf(GetTarget(opc)),
+				ClassOf(opcodes.next[opc]));
+			newClass[i] = refined.insert(
+				std::make_pair(key, (uint32_t)refined.size())).first->second;
+		}
+		for(size_t i = 0; i < live.size(); i++) _class[live[i]] = newClass[i];
+
+		if(refined.size() == classCount) break;
+		classCount = refined.size();
+	}
+
+	_classRep.assign(classCount, NO_OPCODE);
+}
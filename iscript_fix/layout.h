@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef LAYOUT_HEADER_
+#define LAYOUT_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "iscript_opcode.h"
+#include "chunkset.h"
+
+class IScript;
+
+/*
+Run of user opcodes placed in output. Opcodes first..first+count-1 are
+contiguous in user iscript, so they are copied at once and then have
+their pointers patched. A synthetic goto may follow the run.
+*/
+struct CodePiece
+{
+	OpcodeHandle first;
+	uint32_t count;
+	OpcodeHandle gotoTarget;  // NO_OPCODE if run ends on its own.
+	uint32_t offset;
+	uint32_t size;  // Including goto.
+};
+
+// Free range of output that pieces may be placed in.
+struct CodeGap
+{
+	uint32_t offset;
+	uint32_t size;
+};
+
+/*
+Placement of user opcodes in output.
+
+Plain layout emits every chunk whole, one after another. Optimized
+layout also does:
+ - Jump threading : pointers and entry slots landing on a goto are
+   retargeted to where the goto chain ends, so the game doesn't dispatch
+   the gotos. Chunks only reached through such gotos become dead.
+ - Dead code elimination : only opcodes reachable from entry slots are
+   kept. Fall-through only goes forward, so what is left of a chunk is a
+   suffix of it.
+ - Tail merging : opcodes are grouped into classes behaving the same way,
+   i.e. with the same bytes apart from pointers and pointing & falling
+   through to the same classes (found by partition refinement, so loops
+   match too). Once a class is placed, the rest of a later chunk reaching
+   that class is replaced by a goto to it, or dropped if nothing of the
+   chunk is left.
+
+Chunks in 'fixed' already sit somewhere (see DedupChunks) and are left
+as is.
+
+Build decides what gets emitted, and Place decides where. Every piece
+ends with a terminator or goto, so pieces can go anywhere : Place fits
+them into gaps best-fit, largest first, and appends the rest.
+*/
+class CodeLayout
+{
+public:
+	void Build(
+		const IScript& isc,
+		const std::vector<OpcodeHandle>& roots,
+		const ChunkSet& chunks,
+		const ChunkSet& fixed,
+		bool optimize);
+
+	void Place(const std::vector<CodeGap>& gaps, uint32_t appendOffset);
+
+	const std::vector<CodePiece>& GetPieces() const { return _pieces; }
+	uint32_t GetEndOffset() const { return _endOffset; }
+
+	// Final offset of a placed or fixed opcode.
+	uint16_t GetOffset(OpcodeHandle opc) const;
+
+	// Where pointer of opc / an entry slot should point, after threading.
+	OpcodeHandle GetTarget(OpcodeHandle opc) const;
+	OpcodeHandle Thread(OpcodeHandle opc) const
+	{
+		return opc == NO_OPCODE || _thread.empty() ? opc : _thread[opc];
+	}
+
+	// Statistics of optimized layout.
+	uint32_t GetDeadBytes() const { return _deadBytes; }
+	uint32_t GetMergedBytes() const { return _mergedBytes; }
+	uint32_t GetThreadedGotos() const { return _threadedGotos; }
+	uint32_t GetGapBytes() const { return _gapBytes; }
+
+private:
+	void ThreadJumps();
+	void MarkLive(const std::vector<OpcodeHandle>& roots);
+	void ClassifyLive();
+	uint64_t ClassOf(OpcodeHandle opc) const;
+
+	const IScript* _isc;
+	const ChunkSet* _fixed;
+
+	std::vector<OpcodeHandle> _thread;  // Goto chain end of each opcode.
+	std::vector<bool> _live;
+	std::vector<uint32_t> _class;  // Of live opcodes.
+	std::vector<OpcodeHandle> _classRep;  // Placed opcode of each class.
+	std::vector<uint32_t> _offset;  // Of placed opcodes, from piece start until Place.
+
+	std::vector<CodePiece> _pieces;
+	uint32_t _endOffset;
+	uint32_t _deadBytes;
+	uint32_t _mergedBytes;
+	uint32_t _threadedGotos;
+	uint32_t _gapBytes;
+};
+
+#endif
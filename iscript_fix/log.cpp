@@ -0,0 +1,92 @@
+#include "log.h"
+#include "threadlocal.h"
+
+#include <cstdarg>
+#include <cstdio>
+
+#include <chrono>
+
+THREAD_LOCAL_VALUE(std::string*, t_logCapture);
+// ms, 0 if none yet. 32 bits to fit a TLS slot : only differences of
+// recent values matter, and unsigned subtraction gets those across wraps.
+THREAD_LOCAL_VALUE(uint32_t, t_lastProgress);
+static bool s_quiet = false;
+
+static void VLog(const char* fmt, va_list args)
+{
+	std::string* capture = t_logCapture.Get();
+	if(capture == nullptr)
+	{
+		vprintf(fmt, args);
+		return;
+	}
+
+	char buf[512];
+	va_list args2;
+	va_copy(args2, args);
+	int len = vsnprintf(buf, sizeof(buf), fmt, args);
+	if(len < 0) len = 0;
+	if((size_t)len < sizeof(buf)) capture->append(buf, len);
+	else
+	{
+		std::string longbuf(len + 1, '\0');
+		vsnprintf(&longbuf[0], longbuf.size(), fmt, args2);
+		capture->append(longbuf.c_str(), len);
+	}
+	va_end(args2);
+}
+
+void Log(const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	VLog(fmt, args);
+	va_end(args);
+}
+
+void LogProgress(const char* fmt, ...)
+{
+	if(s_quiet)
+	{
+		uint32_t now = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+		uint32_t last = t_lastProgress.Get();
+		if(last && now - last < (uint32_t)LOG_PROGRESS_MS) return;
+		t_lastProgress.Set(now);
+	}
+
+	va_list args;
+	va_start(args, fmt);
+	VLog(fmt, args);
+	va_end(args);
+}
+
+void SetLogQuiet(bool quiet)
+{
+	s_quiet = quiet;
+}
+
+void FatalError(const char* fmt, ...)
+{
+	std::string message;
+	std::string* capture = t_logCapture.Get();
+	t_logCapture.Set(&message);
+
+	va_list args;
+	va_start(args, fmt);
+	VLog(fmt, args);
+	va_end(args);
+
+	t_logCapture.Set(capture);
+	throw FatalErrorException(message);
+}
+
+void SetLogCapture(std::string* buffer)
+{
+	t_logCapture.Set(buffer);
+}
+
+std::string* GetLogCapture()
+{
+	return t_logCapture.Get();
+}
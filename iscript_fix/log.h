@@ -0,0 +1,44 @@
+#pragma once
+
+#ifndef LOG_HEADER_
+#define LOG_HEADER_
+
+#include <stdexcept>
+#include <string>
+
+/*
+Progress & error output. Normally this is plain printf to stdout. When a
+thread sets a capture buffer, its output goes to the buffer instead, so
+jobs running side by side don't mix their lines.
+*/
+
+void Log(const char* fmt, ...);
+
+// Per-item progress line, like "\r - Entry : ...". Same as Log, except in
+// quiet mode where a thread prints one at most every LOG_PROGRESS_MS and
+// skips the rest without formatting them.
+void LogProgress(const char* fmt, ...);
+const int LOG_PROGRESS_MS = 500;
+
+// Set once before any Log.
+void SetLogQuiet(bool quiet);
+
+// Thrown by FatalError, with the formatted message as what().
+class FatalErrorException : public std::runtime_error
+{
+public:
+	explicit FatalErrorException(const std::string& message)
+		: std::runtime_error(message) {}
+};
+
+// Input can't be processed any further. Throws FatalErrorException, for
+// whoever runs the whole job to report. Message is one sentence, without
+// "[Error]" or line breaks.
+void FatalError(const char* fmt, ...);
+
+// Send Log of calling thread to buffer. nullptr restores stdout.
+void SetLogCapture(std::string* buffer);
+// Buffer Log of calling thread goes to, nullptr for stdout.
+std::string* GetLogCapture();
+
+#endif
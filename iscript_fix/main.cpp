@@ -1,207 +1,308 @@
+#include "fixer.h"
+#include "instrument.h"
 #include "iscript.h"
-#include "resource.h"
+#include "log.h"
+#include "outputcache.h"
+#include "parallel.h"
+#include "server.h"
+#include "watch.h"
 
+#include <cctype>
 #include <cstdio>
-#include <cassert>
+#include <cstdlib>
+#include <cstring>
 
-#include <string>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <sstream>
+#include <string>
 #include <fstream>
 
 #include <vector>
-#include <set>
-
-#include <algorithm>
-
-#include <Windows.h>
 
-std::string GetResource(LPCTSTR fname)
+// Manifest has one input path per line. Empty lines and lines starting
+// with '#' are skipped.
+bool ReadManifest(const std::string& fname, std::vector<std::string>* inputs)
 {
-	HMODULE hModule = GetModuleHandle(NULL);
-	HRSRC hRes = FindResource(hModule, fname, RT_RCDATA);
-	HGLOBAL hMem = LoadResource(hModule, hRes);
-	LPVOID lpResource = LockResource(hMem);
-	DWORD size = SizeofResource(hModule, hRes);
-	std::string retdata((char*)lpResource, size);
-	FreeResource(hMem);
-	return retdata;
+	std::ifstream is(fname);
+	if(!is) return false;
+
+	std::string line;
+	while(std::getline(is, line))
+	{
+		if(!line.empty() && line.back() == '\r') line.pop_back();
+		if(line.empty() || line[0] == '#') continue;
+		inputs->push_back(line);
+	}
+	return true;
 }
 
 int main(int argc, char* argv[])
 {
 	if(argc == 1)
 	{
-		printf("Usage : iscript_fix [input file]\n");
+		printf("Usage : iscript_fix [-c] [-d] [-O] [-g] [-C] [-j threads] [-k cache dir] [-m model file] [-q] [-r report] [input file] ...\n");
+		printf("        iscript_fix [-c] [-d] [-O] [-g] [-C] [-j threads] [-k cache dir] [-m model file] [-q] [-r report] @[manifest file]\n");
+		printf("        iscript_fix [-c] [-d] [-O] [-g] [-C] [-m model file] -s\n");
+		printf("        iscript_fix [-c] [-d] [-O] [-g] [-C] [-m model file] -w [input file] ...\n");
+		printf("        -c also emits original entries whose content changed.\n");
+		printf("        -d reuses original code instead of copying it.\n");
+		printf("        -O drops dead opcodes and merges identical tails.\n");
+		printf("        -g fills unused parts of original data first.\n");
+		printf("        -C rebuilds the whole iscript when it doesn't fit otherwise.\n");
+		printf("        -j 0 uses every hardware thread.\n");
+		printf("        -k reuses earlier outputs of identical inputs kept in cache dir.\n");
+		printf("        -m keeps decoded original in model file, to skip decoding next time.\n");
+		printf("        -q throttles per-item progress lines.\n");
+		printf("        -r writes phase times & counters of every input to report as JSON.\n");
+		printf("        -s serves fix requests on stdin/stdout. See server.h for the protocol.\n");
+		printf("        -w watches inputs and fixes them again on change, decoding only what edits touched.\n");
 		return -1;
 	}
 
-	// Read original iscript
-	printf("[1] Reading original iscript.\n");
-	std::string origisc_data = GetResource(MAKEINTRESOURCE(IDR_RCDATA1));
-	std::istringstream iss(origisc_data);
-	IScript origisc(iss);
-	printf("\n");
-
-	// Collect originally used iscript entry IDs.
-	std::vector<uint16_t> origisc_idv = origisc.EnumEntries();
-	std::set<uint16_t> origisc_ids(origisc_idv.begin(), origisc_idv.end());
-	origisc_idv.clear();
-
-
-	// Read user iscript
-	printf("[2] Reading custom iscript.\n");
-	std::string ifname = argv[1];
-	std::string ofname = ifname.substr(0, ifname.size() - 4) + " fixed.bin";
-	IScript userisc(std::ifstream(ifname, std::ifstream::binary));
-	printf("\n");
-
-	// Collect custom used iscript entry IDs.
-	std::vector<uint16_t> userisc_idv = userisc.EnumEntries();
-	std::set<uint16_t> userisc_ids(userisc_idv.begin(), userisc_idv.end());
-	userisc_idv.clear();
-
-
-	std::set<uint16_t> ids_merge, ids_diff;
-	// Merge
-	std::set_union(
-		userisc_ids.begin(), userisc_ids.end(),
-		origisc_ids.begin(), origisc_ids.end(),
-		std::inserter(ids_merge, ids_merge.begin())
-		);
-
-	// Diff
-	std::set_difference(
-		userisc_ids.begin(), userisc_ids.end(),
-		origisc_ids.begin(), origisc_ids.end(),
-		std::inserter(ids_diff, ids_diff.begin())
-		);
-
-
-
-	// Allocate opcodes.
-	printf("[3] Allocating custom opcodes.\n");
-	IScriptDependency isd;
-	for(uint16_t entryID : ids_diff)
+	std::vector<std::string> inputs;
+	unsigned jobThreads = 1;
+	std::string cacheDir;
+	std::string modelFile;
+	std::string reportFile;
+	bool serve = false;
+	bool watch = false;
+	FixOptions options;
+	for(int i = 1; i < argc; i++)
 	{
-		printf("\r - Updating depencency of entry %d...", entryID);
-		userisc.UpdateDependency(entryID, &isd);
-	}
-
-	uint16_t origdataend = *((uint16_t*)origisc_data.data());
-	uint32_t alloc_addr = origdataend;
-	int chkid = 0, chkn = isd.chkSet.size();
-	for(OpcodeChunk* chk : isd.chkSet)
-	{
-		printf("\r - Allocating chunk %d/%d...", ++chkid, chkn);
-		for(Opcode* opc : chk->opcodes)
+		if(strcmp(argv[i], "-c") == 0) options.contentDiff = true;
+		else if(strcmp(argv[i], "-d") == 0) options.dedup = true;
+		else if(strcmp(argv[i], "-O") == 0) options.optimize = true;
+		else if(strcmp(argv[i], "-g") == 0) options.fillGaps = true;
+		else if(strcmp(argv[i], "-C") == 0) options.compact = true;
+		else if(strcmp(argv[i], "-q") == 0) SetLogQuiet(true);
+		else if(strcmp(argv[i], "-s") == 0) serve = true;
+		else if(strcmp(argv[i], "-w") == 0) watch = true;
+		else if(argv[i][0] == '-' && argv[i][1] && strchr("jkmr", argv[i][1]))
 		{
-			opc->allocated_offset = alloc_addr;
-			alloc_addr += opc->size;
+			char option = argv[i][1];
+			const char* value = argv[i] + 2;
+			if(*value == '\0')
+			{
+				if(i + 1 == argc)
+				{
+					printf("[Error] -%c needs a value.\n", option);
+					return -1;
+				}
+				value = argv[++i];
+			}
+			if(option == 'k') cacheDir = value;
+			else if(option == 'm') modelFile = value;
+			else if(option == 'r') reportFile = value;
+			else
+			{
+				char* end;
+				unsigned long n = strtoul(value, &end, 10);
+				if(!isdigit((unsigned char)*value) || *end != '\0' || n > 0xFFFF)
+				{
+					printf("[Error] -j needs a number of threads, got %s.\n", value);
+					return -1;
+				}
+				jobThreads = (unsigned)n;
+				if(jobThreads == 0) jobThreads = GetHardwareThreads();
+			}
+		}
+		else if(argv[i][0] == '@')
+		{
+			if(!ReadManifest(argv[i] + 1, &inputs))
+			{
+				printf("[Error] Cannot open manifest %s.\n", argv[i] + 1);
+				return -1;
+			}
 		}
+		else inputs.push_back(argv[i]);
 	}
 
-	// Allocate entries.
-	printf("\n[4] Allocating iscript entries.\n");
-	std::map<uint16_t, uint16_t> iscEntry_allocaddr;
-	for(uint16_t entryID : ids_diff)
+	// Stdout carries replies, so nothing else may be printed there. What
+	// preparing the original logs, like a model that can't be saved, goes
+	// into the first reply. When preparing fails there is no server to
+	// reply, so only the error goes to stderr.
+	if(serve)
 	{
-		IScriptEntry* iscEntry = userisc.GetEntry(entryID);
-		iscEntry_allocaddr[entryID] = alloc_addr;
-		alloc_addr += 8 + iscEntry->opcodelist.size() * 2;
+		OriginalIScript orig;
+		std::string prepareLog = "[1] Loading original iscript.\n";
+		std::string error;
+		SetLogCapture(&prepareLog);
+		try
+		{
+			orig.Prepare(options, modelFile);
+		}
+		catch(const FatalErrorException& e)
+		{
+			error = e.what();
+		}
+		catch(const std::bad_alloc&)
+		{
+			error = "Out of memory.";
+		}
+		SetLogCapture(nullptr);
+		if(!error.empty())
+		{
+			fprintf(stderr, "[Error] %s\n", error.c_str());
+			return -1;
+		}
+		return RunServer(orig, options, prepareLog, stdin, stdout);
 	}
 
-	// Allocate entry table.
-	alloc_addr += ids_merge.size() * 4 + 4;
-
-	if(alloc_addr > 0x10000)  // iscript.bin too big
+	if(watch)
 	{
-		printf("\n[Error] iscript.bin overflow.\n");
-		std::abort();
+		printf("[1] Loading original iscript.\n");
+		OriginalIScript orig;
+		orig.Prepare(options, modelFile);
+		return RunWatch(orig, options, inputs);
 	}
 
+	// Original iscript is precompiled into the binary, so there is nothing
+	// to read or parse here. What options need from it is built on first
+	// cache miss, so a run served entirely from cache decodes nothing.
+	printf("[1] Loading original iscript.\n");
+	double runStart = GetMonotonicMs();
+	Instrumentation runInst;  // Loading original, which no job owns.
+	OriginalIScript orig;
+	std::once_flag origPrepared;
 
+	std::unique_ptr<OutputCache> cache;
+	if(!cacheDir.empty()) cache.reset(new OutputCache(cacheDir, orig, options));
 
-	// Write payload.
-	printf("[5] Writing payload.\n");
-	std::vector<uint8_t> finalisc_data(alloc_addr);
-	uint8_t* datastart = finalisc_data.data();
-	uint8_t* datacur = datastart;
-
-	// Write original data
-	memcpy(datacur, origisc_data.data(), origdataend);
-	datacur += origdataend;
-
-	// Write user opcodes
-	for(OpcodeChunk* chk : isd.chkSet)
+	struct BatchResult
+	{
+		std::string ofname;
+		bool ok;
+		bool cached;
+		double ms;
+		Instrumentation inst;
+	};
+	std::vector<BatchResult> results(inputs.size());
+
+	auto runJob = [&](size_t i)
 	{
-		for(Opcode* opc : chk->opcodes)
+		const std::string& ifname = inputs[i];
+		if(inputs.size() > 1) Log("\n==== %s ====\n", ifname.c_str());
+
+		BatchResult& result = results[i];
+		result.ofname = GetFixedFileName(ifname);
+		SetInstrumentation(&result.inst);
+		double start = GetMonotonicMs();
+		std::string key;
+		if(cache) key = cache->GetKey(ifname);
+		result.cached = !key.empty() && cache->Fetch(key, result.ofname);
+		if(result.cached)
 		{
-			memcpy(datacur, opc->plaindata.data(), opc->size);
-			if(opc->pointer.ptr)
+			Log("[2] Reusing cached output %s.\n", key.c_str());
+			result.ok = true;
+		}
+		else
+		{
+			std::call_once(origPrepared, [&]()
 			{
-				Opcode* pointee = opc->pointer.ptr;
-				memcpy(
-					datacur + opc->pointer.arg_offset,
-					&pointee->allocated_offset,
-					2
-					);
-			}
-			datacur += opc->size;;
+				// Whatever job comes first does this for the whole run.
+				SetInstrumentation(&runInst);
+				PhaseTimer loadTimer(PHASE_LOAD);
+				orig.Prepare(options, modelFile);
+				loadTimer.Stop();
+				SetInstrumentation(&result.inst);
+			});
+			result.ok = FixIScript(orig, ifname, result.ofname, options);
+			if(result.ok && !key.empty()) cache->Store(key, result.ofname);
 		}
-	}
+		result.ms = GetMonotonicMs() - start;
+		SetInstrumentation(nullptr);
+	};
 
-	// Write user iscript entries.
-	for(uint16_t entryID : ids_diff)
+	if(jobThreads <= 1 || inputs.size() <= 1)
 	{
-		IScriptEntry* iscEntry = userisc.GetEntry(entryID);
-		memcpy(datacur, "SCPE", 4); datacur += 4;
-		*datacur = iscEntry->type; datacur++;
-		*datacur = 0; datacur++;
-		*datacur = 0; datacur++;
-		*datacur = 0; datacur++;
-
-		for(Opcode* opc : iscEntry->opcodelist)
+		for(size_t i = 0; i < inputs.size(); i++) runJob(i);
+	}
+	else
+	{
+		// Each job logs into its own buffer. Buffers are printed in input
+		// order as soon as every earlier job is done, so the console reads
+		// the same as a serial run.
+		std::vector<std::string> logs(inputs.size());
+		std::vector<bool> done(inputs.size(), false);
+		std::mutex printMutex;
+		size_t nextToPrint = 0;
+
+		ThreadPool pool(jobThreads < inputs.size() ? jobThreads : (unsigned)inputs.size());
+		for(size_t i = 0; i < inputs.size(); i++)
 		{
-			if(opc)
+			pool.Submit([&, i]()
 			{
-				memcpy(datacur, &opc->allocated_offset, 2);
-				datacur += 2;
-			}
-			else
-			{
-				*datacur = 0; datacur++;
-				*datacur = 0; datacur++;
-			}
+				SetLogCapture(&logs[i]);
+				runJob(i);
+				SetLogCapture(nullptr);
+
+				std::lock_guard<std::mutex> lock(printMutex);
+				done[i] = true;
+				while(nextToPrint < inputs.size() && done[nextToPrint])
+				{
+					fputs(logs[nextToPrint].c_str(), stdout);
+					std::string().swap(logs[nextToPrint]);
+					nextToPrint++;
+				}
+				fflush(stdout);
+			});
 		}
+		pool.Wait();
 	}
 
-	// Write iscript tables.
-	uint16_t isc_entrytb_offset = datacur - datastart;
-	memcpy(datastart, &isc_entrytb_offset, 2);
-
-	uint16_t origisctblen = origisc_data.size() - origdataend - 4;
-	memcpy(
-		datacur,
-		origisc_data.data() + origdataend,
-		origisctblen
-		);
-	datacur += origisctblen;
-
-	for(uint16_t entryID : ids_diff)
+	int failed = 0;
+	if(inputs.size() > 1) printf("\n[Batch] %d inputs\n", (int)inputs.size());
+	for(size_t i = 0; i < inputs.size(); i++)
 	{
-		uint16_t entryOffset = iscEntry_allocaddr[entryID];
-		memcpy(datacur, &entryID, 2); datacur += 2;
-		memcpy(datacur, &entryOffset, 2); datacur += 2;
+		const BatchResult& result = results[i];
+		if(!result.ok) failed++;
+		if(inputs.size() == 1) break;
+		printf(" - %s -> %s : %s, %.1f ms\n",
+			inputs[i].c_str(),
+			result.ofname.c_str(),
+			result.cached ? "cached" : result.ok ? "ok" : "FAILED",
+			result.ms);
 	}
 
-	memcpy(datacur, "\xFF\xFF\x00\x00", 4); datacur += 4;
-	assert(datacur - datastart == alloc_addr);
-
-	std::ofstream os(ofname, std::ofstream::binary);
-	os.write((const char*)datastart, alloc_addr);
-	os.close();
+	if(!reportFile.empty())
+	{
+		std::ostringstream report;
+		report << std::fixed << std::setprecision(3)
+			<< "{\"version\":1,\"inputs\":" << inputs.size()
+			<< ",\"failed\":" << failed
+			<< ",\"total_ms\":" << GetMonotonicMs() - runStart
+			<< ",\"load_ms\":" << runInst.ms[PHASE_LOAD]
+			<< ",\"load_opcodes\":" << runInst.count[COUNT_OPCODES]
+			<< ",\"load_arena_bytes\":" << (orig.model ? orig.model->GetArenaBytes() : 0)
+			<< ",\"jobs\":[";
+		for(size_t i = 0; i < inputs.size(); i++)
+		{
+			const BatchResult& result = results[i];
+			std::string job;
+			job += "{\"input\":";
+			AppendJsonString(&job, inputs[i]);
+			job += ",\"output\":";
+			AppendJsonString(&job, result.ofname);
+			job += ",";
+			AppendJson(&job, result.inst);
+			report << (i ? "," : "") << job
+				<< ",\"ok\":" << (result.ok ? "true" : "false")
+				<< ",\"cached\":" << (result.cached ? "true" : "false")
+				<< ",\"ms\":" << result.ms << "}";
+		}
+		report << "]}\n";
 
-	printf("[6] Done!\n");
+		std::ofstream os(reportFile, std::ofstream::binary);
+		os << report.str();
+		if(!os)
+		{
+			printf("[Error] Cannot write report %s.\n", reportFile.c_str());
+			return -1;
+		}
+	}
 
-	return 0;
+	return failed ? -1 : 0;
 }
@@ -0,0 +1,245 @@
+#include "mappedfile.h"
+
+#include <cstdio>
+
+#include <atomic>
+#include <string>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : _data(nullptr), _size(0)
+{
+#ifdef _WIN32
+	_hFile = INVALID_HANDLE_VALUE;
+	_hMapping = nullptr;
+#endif
+}
+
+MappedFile::MappedFile(const std::string& fname) : _data(nullptr), _size(0)
+{
+#ifdef _WIN32
+	_hFile = INVALID_HANDLE_VALUE;
+	_hMapping = nullptr;
+#endif
+	Open(fname);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedOutputFile::MappedOutputFile() : _data(nullptr), _size(0)
+{
+#ifdef _WIN32
+	_hFile = INVALID_HANDLE_VALUE;
+	_hMapping = nullptr;
+#else
+	_fd = -1;
+#endif
+}
+
+// Namespace scope, so it is set up before main rather than racing on
+// first use : VS2013 doesn't guard function statics.
+static std::atomic<unsigned> s_writerCount(0);
+
+// fname.<process>.<writer>.tmp, unique among writers of fname.
+static std::string GetTempName(const std::string& fname)
+{
+#ifdef _WIN32
+	unsigned long pid = GetCurrentProcessId();
+#else
+	unsigned long pid = (unsigned long)getpid();
+#endif
+	return fname + "." + std::to_string((unsigned long long)pid) + "." +
+		std::to_string((unsigned long long)s_writerCount++) + ".tmp";
+}
+
+MappedOutputFile::~MappedOutputFile()
+{
+	if(!_tmpName.empty())
+	{
+		Unmap();
+#ifdef _WIN32
+		DeleteFileA(_tmpName.c_str());
+#else
+		unlink(_tmpName.c_str());
+#endif
+	}
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& fname)
+{
+	Close();
+
+	_hFile = CreateFileA(fname.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(_hFile == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fsize;
+	if(!GetFileSizeEx(_hFile, &fsize) || fsize.QuadPart == 0)
+	{
+		// Empty files can't be mapped.
+		Close();
+		return false;
+	}
+
+	_hMapping = CreateFileMappingA(_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(_hMapping == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	_data = (const uint8_t*)MapViewOfFile(_hMapping, FILE_MAP_READ, 0, 0, 0);
+	if(_data == nullptr)
+	{
+		Close();
+		return false;
+	}
+	_size = (size_t)fsize.QuadPart;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if(_data) UnmapViewOfFile(_data);
+	if(_hMapping) CloseHandle(_hMapping);
+	if(_hFile != INVALID_HANDLE_VALUE) CloseHandle(_hFile);
+	_data = nullptr;
+	_size = 0;
+	_hMapping = nullptr;
+	_hFile = INVALID_HANDLE_VALUE;
+}
+
+bool MappedOutputFile::Create(const std::string& fname, size_t size)
+{
+	_fname = fname;
+	_tmpName = GetTempName(fname);
+
+	_hFile = CreateFileA(_tmpName.c_str(), GENERIC_READ | GENERIC_WRITE, 0,
+		NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(_hFile == INVALID_HANDLE_VALUE) return false;
+
+	// Mapping past end of file grows the file to size.
+	_hMapping = CreateFileMappingA(_hFile, NULL, PAGE_READWRITE, 0, (DWORD)size, NULL);
+	if(_hMapping == nullptr) return false;
+
+	_data = (uint8_t*)MapViewOfFile(_hMapping, FILE_MAP_WRITE, 0, 0, size);
+	if(_data == nullptr) return false;
+	_size = size;
+	return true;
+}
+
+void MappedOutputFile::Unmap()
+{
+	if(_data) UnmapViewOfFile(_data);
+	if(_hMapping) CloseHandle(_hMapping);
+	if(_hFile != INVALID_HANDLE_VALUE) CloseHandle(_hFile);
+	_data = nullptr;
+	_hMapping = nullptr;
+	_hFile = INVALID_HANDLE_VALUE;
+}
+
+bool MappedOutputFile::Commit()
+{
+	if(_data == nullptr) return false;
+	if(!FlushViewOfFile(_data, 0) || !FlushFileBuffers(_hFile)) return false;
+	Unmap();
+	if(!MoveFileExA(_tmpName.c_str(), _fname.c_str(),
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		return false;
+	}
+	_tmpName.clear();
+	return true;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& fname)
+{
+	Close();
+
+	int fd = open(fname.c_str(), O_RDONLY);
+	if(fd < 0) return false;
+
+	struct stat st;
+	if(fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);  // Mapping keeps its own reference.
+	if(p == MAP_FAILED) return false;
+
+	_data = (const uint8_t*)p;
+	_size = (size_t)st.st_size;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if(_data) munmap((void*)_data, _size);
+	_data = nullptr;
+	_size = 0;
+}
+
+bool MappedOutputFile::Create(const std::string& fname, size_t size)
+{
+	_fname = fname;
+	_tmpName = GetTempName(fname);
+
+	_fd = open(_tmpName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+	if(_fd < 0) return false;
+	if(ftruncate(_fd, size) != 0) return false;
+
+	void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+	if(p == MAP_FAILED) return false;
+
+	_data = (uint8_t*)p;
+	_size = size;
+	return true;
+}
+
+void MappedOutputFile::Unmap()
+{
+	if(_data) munmap(_data, _size);
+	if(_fd >= 0) close(_fd);
+	_data = nullptr;
+	_fd = -1;
+}
+
+bool MappedOutputFile::Commit()
+{
+	// Unmapped pages would survive the process, but not a power loss.
+	if(_data == nullptr) return false;
+	if(msync(_data, _size, MS_SYNC) != 0 || fsync(_fd) != 0) return false;
+	Unmap();
+	if(rename(_tmpName.c_str(), _fname.c_str()) != 0) return false;
+	_tmpName.clear();
+
+	// Rename itself is durable once the directory is. Best effort.
+	size_t slash = _fname.find_last_of('/');
+	std::string dir = slash == std::string::npos ? "." : _fname.substr(0, slash + 1);
+	int dirfd = open(dir.c_str(), O_RDONLY);
+	if(dirfd >= 0)
+	{
+		fsync(dirfd);
+		close(dirfd);
+	}
+	return true;
+}
+
+#endif
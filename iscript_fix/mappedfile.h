@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef MAPPEDFILE_HEADER_
+#define MAPPEDFILE_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+Read-only memory mapping of a whole file. Decoders can run over data()
+directly without going through stream reads.
+*/
+
+class MappedFile
+{
+public:
+	MappedFile();
+	explicit MappedFile(const std::string& fname);
+	~MappedFile();
+
+	bool Open(const std::string& fname);
+	void Close();
+
+	bool IsOpen() const { return _data != nullptr; }
+	const uint8_t* data() const { return _data; }
+	size_t size() const { return _size; }
+
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+	const uint8_t* _data;
+	size_t _size;
+
+#ifdef _WIN32
+	void* _hFile;
+	void* _hMapping;
+#endif
+};
+
+/*
+Writable mapping of a new file of fixed size. It is written as a temporary
+file next to fname, and Commit flushes it to disk and renames it over
+fname in one step. A run that fails, crashes or loses power before Commit
+never leaves a partial fname behind. Temporary names are unique per
+writer, so jobs writing the same fname at once don't clobber each other.
+*/
+
+class MappedOutputFile
+{
+public:
+	MappedOutputFile();
+	~MappedOutputFile();  // Discards uncommitted output.
+
+	bool Create(const std::string& fname, size_t size);
+	bool Commit();
+
+	uint8_t* data() const { return _data; }
+	size_t size() const { return _size; }
+
+private:
+	MappedOutputFile(const MappedOutputFile&);
+	MappedOutputFile& operator=(const MappedOutputFile&);
+
+	void Unmap();
+
+	std::string _fname;
+	std::string _tmpName;
+	uint8_t* _data;
+	size_t _size;
+
+#ifdef _WIN32
+	void* _hFile;
+	void* _hMapping;
+#else
+	int _fd;
+#endif
+};
+
+#endif
@@ -0,0 +1,34 @@
+#include "offsetindex.h"
+#include "bitops.h"
+
+#include <cstring>
+
+OffsetIndex::OffsetIndex() : _count(0)
+{
+	memset(_bits, 0, sizeof(_bits));
+	memset(_rank, 0, sizeof(_rank));
+}
+
+void OffsetIndex::Insert(uint16_t offset)
+{
+	if(Contains(offset)) return;
+	_bits[offset >> 6] |= (uint64_t)1 << (offset & 63);
+	_count++;
+}
+
+void OffsetIndex::BuildRank()
+{
+	uint32_t rank = 0;
+	for(int w = 0; w < 1024; w++)
+	{
+		_rank[w] = rank;
+		rank += Popcount64(_bits[w]);
+	}
+}
+
+uint32_t OffsetIndex::Find(uint16_t offset) const
+{
+	if(!Contains(offset)) return 0xFFFFFFFF;
+	uint64_t below = _bits[offset >> 6] & (((uint64_t)1 << (offset & 63)) - 1);
+	return _rank[offset >> 6] + Popcount64(below);
+}
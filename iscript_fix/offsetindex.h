@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef OFFSETINDEX_HEADER_
+#define OFFSETINDEX_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Sparse index of decoded 16-bit file offsets.
+
+A 8KB bitmap answers 'is this offset decoded', and per-word prefix counts
+give the rank of an offset : how many decoded offsets lie below it. As
+IScript keeps opcodes sorted by offset, the rank is the opcode handle.
+*/
+
+class OffsetIndex
+{
+public:
+	OffsetIndex();
+
+	bool Contains(uint16_t offset) const
+	{
+		return (_bits[offset >> 6] >> (offset & 63)) & 1;
+	}
+
+	void Insert(uint16_t offset);
+
+	// 64 offsets starting at w * 64 as a bit mask.
+	uint64_t GetWord(int w) const { return _bits[w]; }
+	size_t size() const { return _count; }
+
+	// Recompute ranks. Should be called after a batch of Insert.
+	void BuildRank();
+
+	// Rank of a decoded offset, or 0xFFFFFFFF if offset isn't decoded.
+	uint32_t Find(uint16_t offset) const;
+
+private:
+	uint64_t _bits[1024];
+	uint32_t _rank[1024];  // Decoded offsets before each bitmap word.
+	size_t _count;
+};
+
+#endif
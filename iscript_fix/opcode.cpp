@@ -1,5 +1,9 @@
 #include "iscript_opcode.h"
-#include <istream>
+#include "log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 struct
 {
@@ -77,58 +81,68 @@ struct
 	{ 1 },
 };
 
-void GetOpcode(std::istream& is, Opcode* opc)
+bool IsTerminator(uint8_t opcodeType)
 {
-	memset(opc, 0, sizeof(Opcode));
-
-	opc->parent = nullptr;
-	opc->prev = nullptr;
-	opc->next = nullptr;
-
+	return
+		opcodeType == 0x07 ||  // goto
+		opcodeType == 0x16 ||  // end
+		opcodeType == 0x36;    // return
+}
 
+OpcodeHandle GetOpcode(
+	const uint8_t* data, size_t size, uint16_t offset, OpcodeTable* table)
+{
 	// Get opcode type
-	char opcType;
-	is.read(&opcType, 1);
-
-	if(opcType < 0 || opcType > 0x44)
+	if(offset >= size)
 	{
-		printf("\n[Error] Invalid opcode 0x%02x at %d.\n",
-			opcType & 0xFF, is.tellg().seekpos());
-		std::abort();
+		FatalError("Opcode offset %d out of file (size %d).",
+			offset, (int)size);
 	}
+	const uint8_t* opcp = data + offset;
+	const size_t avail = size - offset;
+	uint8_t opcType = opcp[0];
 
+	if(opcType > 0x44)
+	{
+		FatalError("Invalid opcode 0x%02x at %d.", opcType, offset);
+	}
 
-	// Read entire opcode data
-	char opcodedata[1024];
-	opcodedata[0] = opcType;
 
+	// Get entire opcode length
 	int opcLength = opcdata[opcType].opcodeLength;
 	if(opcLength == -1)  // Variable-length opcode
 	{
-		uint8_t shortn;
-		is.read((char*)&shortn, 1);
+		if(avail < 2)
+		{
+			FatalError("Truncated opcode 0x%02x at %d.", opcType, offset);
+		}
+		uint8_t shortn = opcp[1];
 		opcLength = 1 + 1 + 2 * shortn;
-		is.seekg(-2, is.cur);
 	}
-	else is.seekg(-1, is.cur);
-	
-	opc->size = opcLength;
-	opc->plaindata.resize(opcLength);
-	is.read((char*)opc->plaindata.data(), opcLength);
+
+	if((size_t)opcLength > avail)
+	{
+		FatalError("Truncated opcode 0x%02x at %d.", opcType, offset);
+	}
 
 
 	// Read ptr data
 	int ptrPos = opcdata[opcType].opcodePtr;
+	uint16_t ptrdata = 0;
 	if(ptrPos)  // Opcode has pointer information -> Read it.
 	{
-		uint16_t ptrdata;
-		is.seekg(ptrPos - opcLength, is.cur);
-		is.read((char*)&ptrdata, 2);
-		opc->pointer.ptr = reinterpret_cast<Opcode*>(ptrdata);
-		opc->pointer.arg_offset = ptrPos;
-	}
-	else
-	{
-		opc->pointer.ptr = nullptr;
+		ptrdata = opcp[ptrPos] | (opcp[ptrPos + 1] << 8);
 	}
+
+	OpcodeHandle opc = (OpcodeHandle)table->count();
+	table->type.push_back(opcType);
+	table->size.push_back(opcLength);
+	table->offset.push_back(offset);
+	table->argOffset.push_back(ptrPos);
+	table->targetOffset.push_back(ptrdata);
+	table->target.push_back(NO_OPCODE);
+	table->next.push_back(NO_OPCODE);
+	table->chunk.push_back(0);
+	table->chunkPos.push_back(0);
+	return opc;
 }
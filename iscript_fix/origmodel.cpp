@@ -0,0 +1,2538 @@
+// Generated by iscript_gen from iscript.bin. Do not edit.
+
+#include "origmodel.h"
+
+const uint8_t origIScriptData[40482] = {
+	0xe6, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x0f, 0x00, 0x00, 0x00, 0x84, 0x05, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x20, 0x79,
+	0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x84, 0x05, 0x20, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x79, 0x2c, 0x00, 0x05, 0x01, 0x2c, 0x01, 0x05, 0x01, 0x07, 0x84, 0x05, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x0e, 0x28, 0x02, 0x02, 0x00, 0x0e, 0x26, 0x02, 0x02, 0x01, 0x0d, 0x29, 0x02, 0x02, 0x02,
+	0x0d, 0x27, 0x02, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00,
+	0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x28, 0x06, 0x49, 0x06, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x26, 0x06, 0x49, 0x06, 0x17, 0x01, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05,
+	0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x07, 0x28, 0x06, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x66, 0x06, 0x87, 0x06, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x64, 0x06, 0x87, 0x06, 0x17, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x07, 0x66, 0x06, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0xa4, 0x06, 0xe3, 0x06, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x06,
+	0xe3, 0x06, 0x17, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e,
+	0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00,
+	0x05, 0x02, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00, 0x13, 0x00, 0x05, 0x02, 0x00, 0x14, 0x00, 0x05,
+	0x02, 0x00, 0x15, 0x00, 0x05, 0x02, 0x00, 0x16, 0x00, 0x05, 0x02, 0x00, 0x17, 0x00, 0x05, 0x02,
+	0x07, 0xa4, 0x06, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x3f, 0x07, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x3f, 0x07, 0x17, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x07, 0x00, 0x07, 0x05,
+	0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x52, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x2d, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x07, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xac, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x07, 0xc8, 0x07, 0xc8, 0x07,
+	0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x18, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07,
+	0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00,
+	0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05,
+	0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x1b, 0x05,
+	0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x34, 0x08, 0x20, 0x79, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05,
+	0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x00, 0x1b, 0x00, 0x05, 0x01, 0x00, 0x24, 0x00, 0x05, 0x01,
+	0x00, 0x2d, 0x00, 0x05, 0x01, 0x00, 0x36, 0x00, 0x05, 0x01, 0x00, 0x3f, 0x00, 0x05, 0x01, 0x00,
+	0x48, 0x00, 0x05, 0x01, 0x00, 0x51, 0x00, 0x05, 0x01, 0x00, 0x5a, 0x00, 0x05, 0x01, 0x00, 0x63,
+	0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x80, 0x08, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00,
+	0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x07, 0x80, 0x08, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xa8, 0x08, 0xbc, 0x08, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x08, 0x13, 0x09, 0x18, 0x9a, 0x03, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03,
+	0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x03, 0x00, 0x06, 0x00,
+	0x05, 0x03, 0x00, 0x07, 0x00, 0x05, 0x03, 0x00, 0x08, 0x00, 0x05, 0x03, 0x00, 0x09, 0x00, 0x05,
+	0x03, 0x00, 0x08, 0x00, 0x05, 0x03, 0x00, 0x07, 0x00, 0x05, 0x03, 0x00, 0x06, 0x00, 0x05, 0x03,
+	0x07, 0xe8, 0x08, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00,
+	0x01, 0x00, 0x05, 0x03, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00, 0x03, 0x00, 0x05, 0x03, 0x00, 0x04,
+	0x00, 0x05, 0x03, 0x00, 0x05, 0x00, 0x05, 0x03, 0x00, 0x06, 0x00, 0x05, 0x03, 0x00, 0x07, 0x00,
+	0x05, 0x03, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x70, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x01, 0x00, 0x05, 0x03, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00,
+	0x03, 0x00, 0x05, 0x03, 0x00, 0x04, 0x00, 0x05, 0x03, 0x00, 0x05, 0x00, 0x05, 0x03, 0x00, 0x06,
+	0x00, 0x05, 0x03, 0x00, 0x07, 0x00, 0x05, 0x03, 0x00, 0x08, 0x00, 0x05, 0x03, 0x00, 0x09, 0x00,
+	0x05, 0x03, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xb4, 0x09, 0xbd, 0x09,
+	0xbd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x18, 0x30, 0x03,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x1b, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00,
+	0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09,
+	0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00,
+	0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x14, 0x0a, 0x20, 0x79, 0x32, 0x06, 0x01, 0x03, 0x33, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x06, 0x02, 0x03, 0x07, 0x19,
+	0x0a, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x48, 0x0a, 0x48, 0x0a,
+	0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00,
+	0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05,
+	0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x88, 0x0a, 0x20, 0x79, 0x1a, 0x6b, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05,
+	0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02,
+	0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x01, 0x00,
+	0x05, 0x03, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00, 0x03, 0x00, 0x05, 0x03, 0x00, 0x04, 0x00, 0x05,
+	0x03, 0x00, 0x05, 0x00, 0x05, 0x03, 0x00, 0x06, 0x00, 0x05, 0x03, 0x00, 0x07, 0x00, 0x05, 0x03,
+	0x00, 0x08, 0x00, 0x05, 0x03, 0x00, 0x09, 0x00, 0x05, 0x03, 0x00, 0x0a, 0x00, 0x05, 0x03, 0x00,
+	0x0b, 0x00, 0x05, 0x03, 0x00, 0x0c, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x16, 0x0b, 0x2f, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02,
+	0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x01, 0x05,
+	0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0b, 0x58, 0x0b, 0xba, 0x79,
+	0x00, 0x00, 0x32, 0x3a, 0x28, 0x00, 0x49, 0x0b, 0x33, 0x00, 0x00, 0x00, 0x18, 0x4a, 0x00, 0x05,
+	0x01, 0x24, 0x01, 0x05, 0x01, 0x07, 0xba, 0x79, 0x08, 0xbf, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x0b, 0xa3, 0x0b, 0x18, 0x4d,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00,
+	0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09,
+	0x00, 0x05, 0x01, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xb2, 0x0b,
+	0xcb, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x05, 0x01, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xda, 0x0b, 0xe0, 0x0b, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x48, 0x0c,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05,
+	0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02,
+	0x00, 0x08, 0x00, 0x05, 0x02, 0x07, 0x13, 0x0c, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x5a, 0x0c, 0x20, 0x79, 0x00, 0x00, 0x00, 0x17, 0x01, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0xc4, 0x0c, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02,
+	0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00,
+	0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x0d, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03,
+	0x00, 0x09, 0x2b, 0x02, 0x00, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00,
+	0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x94, 0x0d, 0x08, 0x0e, 0x2e, 0x32, 0x3a, 0x46, 0x00, 0xd3, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x33, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01,
+	0x07, 0x08, 0x0e, 0x00, 0x22, 0x00, 0x05, 0x01, 0x33, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01,
+	0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00,
+	0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22,
+	0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x2f, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x02, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x22, 0x0e, 0x22, 0x0e, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x1b, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05,
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x0e, 0x20, 0x79, 0x32, 0x06, 0x01, 0x03,
+	0x33, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x03, 0x00, 0x06, 0x02, 0x03, 0x07, 0x71, 0x0e, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x96, 0x0e, 0x20, 0x79, 0x18, 0x9c, 0x03, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01,
+	0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05,
+	0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01,
+	0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01, 0x00,
+	0x0e, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xf6, 0x0e,
+	0x00, 0x0f, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x07, 0xba, 0x79,
+	0x1b, 0x08, 0xfc, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x16, 0x0f, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00,
+	0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08,
+	0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00,
+	0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x64, 0x0f, 0x7a, 0x0f,
+	0x6d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00,
+	0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x07, 0x6d, 0x0f, 0x1b, 0x18, 0x48, 0x00, 0x08, 0xfe,
+	0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x92, 0x0f,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05,
+	0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x0f, 0x20, 0x79, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00,
+	0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x07, 0xbe, 0x0f, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xec, 0x0f, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00,
+	0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x26, 0x10, 0x72, 0x10, 0x00, 0x00, 0x00, 0x32, 0x06, 0x03, 0x08, 0x33, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x06, 0x01,
+	0x03, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02,
+	0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x07,
+	0x4e, 0x10, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x10,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05,
+	0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x10,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01,
+	0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00,
+	0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c,
+	0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x20, 0x11, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x32, 0x11,
+	0x5a, 0x11, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x11, 0x20, 0x79, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xac, 0x11, 0x32, 0x12, 0x18, 0xb2, 0x00, 0x00,
+	0x04, 0x00, 0x2e, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a,
+	0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00,
+	0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05,
+	0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x27, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x01, 0x24, 0x02,
+	0x2f, 0x2a, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x42, 0x12,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c,
+	0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x96, 0x12, 0xdc, 0x12, 0x1a, 0x3a, 0x01, 0x3b, 0x01, 0x07, 0xa0, 0x12, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x07, 0xc8,
+	0x12, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00,
+	0x05, 0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x07, 0xdc, 0x12, 0x05, 0x01, 0x2f, 0x2a, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xee, 0x12, 0x20, 0x79, 0x00, 0x00,
+	0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x13, 0x20, 0x79,
+	0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79,
+	0x00, 0x00, 0x18, 0x13, 0x20, 0x79, 0x00, 0x00, 0x05, 0x01, 0x1d, 0x07, 0x18, 0x13, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x13, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x60, 0x13, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x86, 0x13, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x13, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xec, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a,
+	0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00,
+	0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05,
+	0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x54, 0x14, 0x20, 0x79, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05,
+	0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01,
+	0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
+	0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b,
+	0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x14, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x14, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x24, 0x15, 0x2a, 0x15,
+	0x2a, 0x15, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x18, 0x07, 0x00,
+	0x05, 0x01, 0x1b, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00,
+	0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05,
+	0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01,
+	0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00,
+	0x0d, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x9a, 0x15,
+	0xa7, 0x15, 0xa7, 0x15, 0xa7, 0x15, 0x00, 0x00, 0xa7, 0x15, 0xa7, 0x15, 0x00, 0x00, 0xa7, 0x15,
+	0xa7, 0x15, 0x00, 0x00, 0xa7, 0x15, 0xa7, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x07, 0x9a, 0x15, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0xb6, 0x15, 0x20, 0x79, 0x18, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x18, 0x0d, 0x00,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x18, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x05,
+	0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02,
+	0x00, 0x0d, 0x00, 0x05, 0x02, 0x18, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00,
+	0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05,
+	0x02, 0x18, 0x0d, 0x00, 0x00, 0x13, 0x00, 0x05, 0x02, 0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15,
+	0x00, 0x05, 0x02, 0x00, 0x16, 0x00, 0x05, 0x02, 0x00, 0x17, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00,
+	0x05, 0x02, 0x00, 0x19, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x54, 0x16, 0x61, 0x16, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x07, 0x54,
+	0x16, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x70, 0x16, 0x84, 0x16,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00,
+	0x33, 0x00, 0x05, 0x01, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x94, 0x16, 0xbc, 0x16, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x11, 0x00, 0x05, 0x03, 0x00, 0x22,
+	0x00, 0x05, 0x03, 0x00, 0x33, 0x00, 0x05, 0x03, 0x00, 0x44, 0x00, 0x05, 0x03, 0x00, 0x55, 0x00,
+	0x05, 0x03, 0x00, 0x66, 0x00, 0x05, 0x03, 0x00, 0x77, 0x00, 0x05, 0x03, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x16, 0xe4, 0x16, 0x00, 0x00, 0x00, 0x08,
+	0x4a, 0x02, 0x82, 0xb3, 0x08, 0x49, 0x02, 0x7e, 0x4d, 0x08, 0x4b, 0x02, 0x82, 0x4d, 0x04, 0x7e,
+	0xb3, 0x07, 0xba, 0x79, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0xf4, 0x16, 0x20, 0x79, 0x18, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05,
+	0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01,
+	0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
+	0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x4e, 0x17, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x4e, 0x17, 0x20, 0x79, 0x00, 0x00, 0x05, 0x01,
+	0x2b, 0x00, 0x05, 0x01, 0x2b, 0x11, 0x07, 0x4e, 0x17, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x66, 0x17, 0x78, 0x17, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01,
+	0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x0e, 0x00, 0x00, 0x00, 0xa4, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xb2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x02, 0x32, 0x05, 0x05, 0x24, 0x01, 0x05,
+	0x01, 0x16, 0x33, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00,
+	0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05,
+	0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02,
+	0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00,
+	0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x07, 0xb3, 0x17, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x08, 0x18, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00,
+	0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x24, 0x18, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02,
+	0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00,
+	0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05,
+	0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01,
+	0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
+	0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xc8, 0x18, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x05, 0x7d, 0x05,
+	0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x00, 0x01, 0x00, 0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d,
+	0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x00, 0x02, 0x00, 0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x05,
+	0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x00, 0x03, 0x00, 0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d, 0x05, 0x7d,
+	0x05, 0x7d, 0x05, 0x7d, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x12, 0x19,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c,
+	0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00,
+	0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x70, 0x19, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x07, 0x70, 0x19, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x98, 0x19, 0xcd, 0x19, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07,
+	0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x01, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x19, 0x20, 0x79, 0x32, 0x05, 0x02, 0x33,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00,
+	0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06,
+	0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x16, 0x1a, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02,
+	0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x00,
+	0x55, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x46, 0x1a, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08,
+	0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0x86, 0x1a, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0xa8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02,
+	0x00, 0x08, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x1a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1b,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c,
+	0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00,
+	0x00, 0x00, 0x76, 0x1b, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01,
+	0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05,
+	0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x0c, 0x00, 0x00, 0x00, 0xd0, 0x1b, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00, 0xd0, 0x1b, 0x20, 0x79, 0x00, 0x00,
+	0x05, 0x01, 0x2b, 0x00, 0x05, 0x01, 0x2b, 0x11, 0x07, 0xd0, 0x1b, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xe8, 0x1b, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x01, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x1c, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x1c, 0x20, 0x79, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00,
+	0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05,
+	0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02,
+	0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xc8, 0x1c, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01,
+	0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x0c, 0x00, 0x00, 0x00, 0x20, 0x1d, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x25, 0x1d, 0x00, 0x00,
+	0x09, 0x53, 0x01, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0xba, 0x79, 0x18, 0x35, 0x00, 0x34, 0x00,
+	0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0x9a, 0x00, 0x05, 0x01, 0x00, 0x9b, 0x00, 0x05, 0x01, 0x00,
+	0x9c, 0x00, 0x05, 0x01, 0x00, 0x9d, 0x00, 0x05, 0x01, 0x00, 0x9e, 0x00, 0x05, 0x01, 0x00, 0x9f,
+	0x00, 0x05, 0x01, 0x00, 0xa0, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x33, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x07, 0x59, 0x1d, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x0c, 0x00, 0x00, 0x00, 0xc0, 0x1d, 0xcb, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x1d, 0xc5, 0x1d, 0x00, 0x00,
+	0x09, 0x55, 0x01, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0xba, 0x79, 0x18, 0x39, 0x00, 0x34, 0x00,
+	0x00, 0xbb, 0x00, 0x05, 0x01, 0x00, 0xbc, 0x00, 0x05, 0x01, 0x00, 0xbd, 0x00, 0x05, 0x01, 0x00,
+	0xbe, 0x00, 0x05, 0x01, 0x00, 0xbf, 0x00, 0x05, 0x01, 0x00, 0xc0, 0x00, 0x05, 0x01, 0x00, 0xc1,
+	0x00, 0x05, 0x01, 0x00, 0xc2, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x07, 0xf9, 0x1d, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x7e, 0x1e, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x83, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x09, 0x2c,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0xae, 0x1e, 0xc5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x1e, 0xb3, 0x1e, 0x00, 0x00, 0x09, 0xde,
+	0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x80, 0xc0, 0x1e, 0x07, 0xb6, 0x1e,
+	0x22, 0x03, 0x07, 0xb3, 0x1e, 0x1a, 0x14, 0x01, 0x15, 0x01, 0x08, 0xf2, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x07, 0xd2, 0x1e, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x1f, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x39, 0x28, 0x1f,
+	0x09, 0x99, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x0b, 0x9a, 0x01, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x44, 0x1f, 0x78, 0x1f, 0x00, 0x00, 0x00, 0x39, 0x52, 0x1f, 0x09, 0x9b, 0x01, 0x00, 0x00, 0x07,
+	0x57, 0x1f, 0x05, 0x01, 0x0b, 0x9c, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02,
+	0x00, 0x05, 0x00, 0x05, 0x02, 0x07, 0x57, 0x1f, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x98, 0x1f, 0xb4, 0x1f, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xa6, 0x1f, 0xb4, 0x1f, 0x00, 0x00, 0x00, 0x39, 0xba, 0x79, 0x09, 0x96,
+	0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x11, 0x00, 0x39, 0xba, 0x79, 0x09, 0x96, 0x01, 0x00,
+	0x00, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xd4, 0x1f, 0xf0, 0x1f, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0xe2, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x39, 0xba, 0x79, 0x09, 0x97, 0x01, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x00, 0x11, 0x00, 0x39, 0xba, 0x79, 0x09, 0x97, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0x20, 0x2c, 0x20, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x20, 0x2c, 0x20,
+	0x00, 0x00, 0x00, 0x39, 0xba, 0x79, 0x09, 0x98, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01,
+	0x00, 0x39, 0xba, 0x79, 0x09, 0x98, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x20, 0xe3, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x20, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0xb2, 0x20, 0xb2, 0x20, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0xd8, 0x20, 0xe3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xba, 0x79,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xeb, 0x20, 0x20, 0x79, 0x01, 0x00, 0x00, 0x09, 0x5a, 0x01, 0x00, 0x00,
+	0x05, 0x0f, 0x38, 0x00, 0x06, 0x05, 0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x38, 0x01, 0x06, 0x05,
+	0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x38, 0x00, 0x06, 0x05, 0x32, 0x38, 0x01, 0x06, 0x05, 0x32,
+	0x38, 0x02, 0x06, 0x05, 0x32, 0x07, 0xb2, 0x20, 0x01, 0x00, 0x00, 0x09, 0x5a, 0x01, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x01, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x26, 0x21, 0x23, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x21, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45,
+	0x0c, 0x00, 0x00, 0x00, 0x50, 0x21, 0x5b, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x21, 0x55, 0x21, 0x00, 0x00,
+	0x09, 0x57, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x31, 0x00, 0x34, 0x00,
+	0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xcd, 0x00, 0x05, 0x01, 0x00, 0xce, 0x00, 0x05, 0x01, 0x00,
+	0xcf, 0x00, 0x05, 0x01, 0x00, 0xd0, 0x00, 0x05, 0x01, 0x00, 0xd1, 0x00, 0x05, 0x01, 0x00, 0xd2,
+	0x00, 0x05, 0x01, 0x00, 0xd3, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x07, 0x89, 0x21,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xec, 0x21, 0x02, 0x22, 0x00, 0x00, 0x00, 0x39,
+	0xfa, 0x21, 0x09, 0x9f, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x0b, 0xa0, 0x01, 0x07,
+	0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x3e, 0x22, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x22, 0x49, 0x22, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x22, 0x4f, 0x22, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x4f, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00,
+	0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x07, 0x4f, 0x22, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x49,
+	0x22, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x22, 0x94, 0x22, 0x00, 0x00,
+	0x00, 0x39, 0x8c, 0x22, 0x09, 0x9d, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x0b, 0x9e,
+	0x01, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x14, 0x00, 0x00, 0x00, 0xd0, 0x22, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd0, 0x22, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x72, 0x23,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x23, 0x93, 0x23, 0x8d, 0x23, 0x87, 0x23,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x23, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x7a, 0x23, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x23, 0x93, 0x23,
+	0x8d, 0x23, 0x87, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x23, 0x00, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x82, 0x23, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x99, 0x23, 0x93, 0x23, 0x8d, 0x23, 0x87, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x23,
+	0x00, 0x00, 0x09, 0x5c, 0x01, 0x00, 0x00, 0x07, 0x87, 0x23, 0x09, 0x5e, 0x01, 0x00, 0x00, 0x07,
+	0x87, 0x23, 0x09, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x02, 0x00, 0x07, 0xba, 0x79, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x23, 0xc6, 0x23, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xb8, 0x23, 0xc6, 0x23, 0x00, 0x00, 0x00, 0x39, 0xba, 0x79, 0x09, 0x95,
+	0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xda, 0x23, 0xe0, 0x23, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0xf4, 0x23, 0x2d, 0x24, 0x39, 0xff, 0x23, 0x09, 0xa1, 0x01, 0x00, 0x00, 0x07, 0x07, 0x24, 0x05,
+	0x01, 0x0b, 0xa2, 0x01, 0x07, 0x07, 0x24, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02,
+	0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x07, 0x07, 0x24, 0x08, 0x4c, 0x01,
+	0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x6a, 0x24,
+	0x70, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x24,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0xac, 0x24, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xac, 0x24, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xe6, 0x24, 0x83, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xf8, 0x24, 0x1c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x07, 0xfb, 0x24, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x52, 0x25, 0x65, 0x25, 0x7d, 0x25, 0x7d, 0x25, 0x00, 0x00,
+	0x7f, 0x25, 0x7f, 0x25, 0xa3, 0x25, 0xa2, 0x79, 0xa2, 0x79, 0x00, 0x00, 0x70, 0x25, 0xa2, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5d, 0x25, 0x09, 0x83, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x08, 0x85, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x07, 0x00, 0x08, 0xd5, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16,
+	0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x03, 0x00, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x2e, 0x25, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05,
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x2a,
+	0x07, 0xba, 0x79, 0x2e, 0x05, 0x01, 0x18, 0x24, 0x02, 0x27, 0x2f, 0x2a, 0x24, 0x02, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x23, 0x26, 0xd6, 0x25, 0x62, 0x26,
+	0x62, 0x26, 0x00, 0x00, 0x62, 0x26, 0x62, 0x26, 0x00, 0x00, 0x62, 0x26, 0x62, 0x26, 0x00, 0x00,
+	0x62, 0x26, 0x62, 0x26, 0xe1, 0x25, 0x18, 0x07, 0x00, 0x08, 0xd6, 0x00, 0x00, 0x00, 0x05, 0x03,
+	0x16, 0x18, 0x69, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c,
+	0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00,
+	0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05,
+	0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02,
+	0x07, 0xee, 0x25, 0x00, 0x12, 0x00, 0x05, 0x01, 0x2e, 0x05, 0x01, 0x00, 0x13, 0x00, 0x05, 0x02,
+	0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15, 0x00, 0x05, 0x02, 0x00, 0x16, 0x00, 0x05, 0x02, 0x00,
+	0x17, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x05, 0x02, 0x00, 0x19, 0x00, 0x05, 0x02, 0x00, 0x1a,
+	0x00, 0x05, 0x02, 0x08, 0x87, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x24, 0x04, 0x2f,
+	0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01,
+	0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00,
+	0x09, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x06,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x07, 0x62, 0x26, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0xe4, 0x26, 0x20, 0x79, 0x07, 0x27, 0x07, 0x27,
+	0x00, 0x00, 0x07, 0x27, 0x07, 0x27, 0x00, 0x00, 0xe6, 0x26, 0xe6, 0x26, 0x00, 0x00, 0xe6, 0x26,
+	0xe6, 0x26, 0x00, 0x00, 0x34, 0x0f, 0x00, 0xaa, 0x00, 0x05, 0x04, 0x00, 0xbb, 0x00, 0x05, 0x04,
+	0x00, 0xcc, 0x00, 0x05, 0x04, 0x00, 0xdd, 0x00, 0x05, 0x04, 0x00, 0xcc, 0x00, 0x05, 0x04, 0x00,
+	0xbb, 0x00, 0x05, 0x04, 0x07, 0xe6, 0x26, 0x00, 0x00, 0x00, 0x05, 0x01, 0x2e, 0x00, 0x11, 0x00,
+	0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05,
+	0x01, 0x00, 0x55, 0x00, 0x3a, 0x30, 0x00, 0x2e, 0x27, 0x0d, 0x25, 0x02, 0x00, 0x00, 0x18, 0x3a,
+	0x00, 0x26, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x03, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0x88,
+	0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00,
+	0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x2f, 0x2a, 0x07, 0xe6, 0x26, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x68, 0x27, 0x20, 0x79, 0x32, 0x06, 0x01, 0x05, 0x33, 0x00, 0x00, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00,
+	0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d,
+	0x00, 0x05, 0x01, 0x00, 0x0e, 0x00, 0x05, 0x01, 0x07, 0x6d, 0x27, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x15, 0x00, 0x00, 0x00, 0xf0, 0x27, 0x01, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0xa2, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x27,
+	0x3d, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x08, 0x73, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x1a, 0x53, 0x02, 0x54, 0x02, 0x08, 0xd6, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x08, 0x72,
+	0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x4a, 0x28,
+	0x88, 0x28, 0xf3, 0x28, 0xf3, 0x28, 0x00, 0x00, 0x11, 0x29, 0x11, 0x29, 0x00, 0x00, 0x27, 0x29,
+	0x27, 0x29, 0x00, 0x00, 0xb8, 0x28, 0x4f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0x09, 0x7b, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00,
+	0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x05, 0x02, 0x00, 0x66,
+	0x00, 0x05, 0x02, 0x00, 0x77, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0x55, 0x28,
+	0x08, 0x7d, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0xed, 0x01, 0x34, 0x00, 0x00, 0x98, 0x01,
+	0x05, 0x02, 0x00, 0x99, 0x01, 0x05, 0x02, 0x00, 0x9a, 0x01, 0x05, 0x02, 0x00, 0x9b, 0x01, 0x05,
+	0x02, 0x00, 0x9c, 0x01, 0x05, 0x02, 0x00, 0x9d, 0x01, 0x05, 0x02, 0x00, 0x9e, 0x01, 0x05, 0x02,
+	0x11, 0xc0, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29,
+	0x06, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x08, 0x05,
+	0x01, 0x00, 0xbb, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0xcc, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00,
+	0xdd, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0xee, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0xff, 0x00,
+	0x07, 0xb8, 0x28, 0x00, 0x10, 0x01, 0x05, 0x01, 0x00, 0x21, 0x01, 0x05, 0x01, 0x00, 0x32, 0x01,
+	0x05, 0x01, 0x00, 0x43, 0x01, 0x05, 0x01, 0x00, 0x54, 0x01, 0x05, 0x01, 0x00, 0x65, 0x01, 0x05,
+	0x01, 0x00, 0x76, 0x01, 0x05, 0x01, 0x00, 0x87, 0x01, 0x05, 0x01, 0x25, 0x01, 0x00, 0x76, 0x01,
+	0x05, 0x01, 0x00, 0x65, 0x01, 0x2a, 0x30, 0x05, 0x01, 0x00, 0x54, 0x01, 0x05, 0x01, 0x00, 0x43,
+	0x01, 0x05, 0x01, 0x00, 0x32, 0x01, 0x05, 0x01, 0x00, 0x21, 0x01, 0x05, 0x01, 0x00, 0x10, 0x01,
+	0x07, 0x4f, 0x28, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x50, 0x29, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00,
+	0x03, 0x00, 0x05, 0x32, 0x00, 0x04, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x8e, 0x29, 0x94, 0x29, 0xda, 0x29, 0x00, 0x00, 0x00, 0x00, 0xda, 0x29, 0x00, 0x00,
+	0x17, 0x2a, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x29, 0x8e, 0x29, 0x00, 0x00, 0x00, 0xdd,
+	0x00, 0x07, 0xba, 0x79, 0x18, 0xe5, 0x02, 0x08, 0x99, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0xee, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xff, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0x10, 0x01, 0x29, 0x04, 0x05, 0x01, 0x00, 0x21, 0x01, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0xaa, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xcc, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x07, 0x9f, 0x29, 0x18, 0x6f, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x01, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x25, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66,
+	0x00, 0x05, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00,
+	0x05, 0x01, 0x2f, 0x2a, 0x07, 0x8e, 0x29, 0x27, 0x24, 0x02, 0x2a, 0x07, 0x8e, 0x29, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x2a, 0x4d, 0x2a, 0x60, 0x2a, 0x60, 0x2a, 0x00, 0x00,
+	0x60, 0x2a, 0x60, 0x2a, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x58, 0x2a, 0xa2, 0x79,
+	0x00, 0x00, 0x09, 0x75, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x18, 0x08, 0x00,
+	0x08, 0xd5, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79,
+	0x05, 0x01, 0x25, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x07, 0xba, 0x79,
+	0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0xa4, 0x2a, 0xb7, 0x2a, 0xc0, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x2a,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xaf, 0x2a, 0x09, 0x8a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0x8b, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x56, 0x02, 0x08, 0xd5, 0x00, 0x00, 0x00, 0x05,
+	0x03, 0x16, 0x28, 0x3f, 0x05, 0x01, 0x06, 0x08, 0x0a, 0x07, 0xc2, 0x2a, 0x03, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x06, 0x2b, 0x19, 0x2b, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x2b, 0x0b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x2b, 0x09, 0x77, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2,
+	0x79, 0x08, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x02, 0x02, 0x08, 0xd5, 0x00, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x08, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x66, 0x2b, 0x79, 0x2b, 0x91, 0x2b,
+	0xb3, 0x2b, 0x00, 0x00, 0x91, 0x2b, 0xb3, 0x2b, 0x00, 0x00, 0x6b, 0x2b, 0x6b, 0x2b, 0x00, 0x00,
+	0x84, 0x2b, 0xa2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x71, 0x2b, 0x09, 0x8d, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2,
+	0x79, 0x08, 0x8f, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x15, 0x02, 0x08, 0xd5, 0x00, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x08, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x11, 0x00, 0x05, 0x01, 0x25, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2a,
+	0x07, 0xba, 0x79, 0x00, 0x11, 0x00, 0x05, 0x01, 0x25, 0x02, 0x00, 0x00, 0x00, 0x2a, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0xf6, 0x2b, 0x2f, 0x2c, 0x88, 0x2c,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x2c, 0x00, 0x00, 0xaf, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x2c, 0x76, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x2c, 0x09, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x06, 0x01,
+	0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00, 0x77, 0x00, 0x05, 0x02, 0x00, 0x88, 0x00, 0x05, 0x02,
+	0x00, 0x99, 0x00, 0x05, 0x02, 0x00, 0xaa, 0x00, 0x05, 0x02, 0x00, 0xbb, 0x00, 0x05, 0x02, 0x00,
+	0xcc, 0x00, 0x05, 0x02, 0x07, 0x01, 0x2c, 0x08, 0x80, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18,
+	0x7b, 0x02, 0x34, 0x00, 0x00, 0x21, 0x01, 0x05, 0x02, 0x00, 0x22, 0x01, 0x05, 0x02, 0x00, 0x23,
+	0x01, 0x05, 0x02, 0x00, 0x24, 0x01, 0x05, 0x02, 0x00, 0x25, 0x01, 0x05, 0x02, 0x00, 0x26, 0x01,
+	0x05, 0x02, 0x00, 0x27, 0x01, 0x05, 0x02, 0x16, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xff, 0x00,
+	0x05, 0x01, 0x00, 0x10, 0x01, 0x05, 0x01, 0x00, 0x55, 0x00, 0x03, 0x00, 0x05, 0x03, 0x13, 0x40,
+	0x01, 0x00, 0x00, 0x07, 0x6c, 0x2c, 0x00, 0x10, 0x01, 0x05, 0x01, 0x00, 0xff, 0x00, 0x05, 0x01,
+	0x00, 0xee, 0x00, 0x05, 0x01, 0x07, 0x01, 0x2c, 0x18, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x2e, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01,
+	0x25, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x00, 0x66, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x00, 0x00, 0x2e, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00,
+	0x33, 0x00, 0x05, 0x01, 0x27, 0x24, 0x02, 0x00, 0x44, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x00, 0x66,
+	0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x1b, 0x2d,
+	0x68, 0x2d, 0x68, 0x2d, 0x00, 0x00, 0x68, 0x2d, 0x68, 0x2d, 0x00, 0x00, 0x75, 0x2d, 0x75, 0x2d,
+	0x00, 0x00, 0x26, 0x2d, 0x0d, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x09, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x92, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x7e, 0x02, 0x08, 0xd6,
+	0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x29, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x00, 0x05,
+	0x01, 0x00, 0x22, 0x00, 0x29, 0x01, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x01, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x66, 0x00,
+	0x29, 0x03, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x01, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x06,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x07, 0x26, 0x2d, 0x05, 0x01, 0x1a, 0x66, 0x00, 0x67, 0x00, 0x25,
+	0x01, 0x05, 0x01, 0x2a, 0x30, 0x07, 0x0d, 0x2d, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00,
+	0x9c, 0x2d, 0xa9, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x2d, 0x9c, 0x2d, 0xa2, 0x2d, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x28, 0x52, 0x24, 0x01, 0x07, 0xba, 0x79, 0x08, 0xbc, 0x01, 0x00, 0x00, 0x05, 0x01,
+	0x16, 0x37, 0x00, 0x08, 0x29, 0x10, 0x0f, 0x75, 0x01, 0x00, 0x00, 0x05, 0x01, 0x07, 0xb1, 0x2d,
+	0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0xf4, 0x2d, 0x07, 0x2e, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e,
+	0xa2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0x2d, 0x09, 0x95, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x08,
+	0x96, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x1a, 0x8b, 0x02, 0x8c, 0x02, 0x08, 0xd6, 0x00, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45,
+	0x15, 0x00, 0x00, 0x00, 0x5c, 0x2e, 0x6f, 0x2e, 0xd3, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x2e,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x98, 0x2e, 0x61, 0x2e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x2e,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x72, 0x2e, 0x20, 0x79, 0x09, 0x98, 0x00, 0x00,
+	0x00, 0x00, 0x55, 0x00, 0x07, 0xba, 0x79, 0x08, 0x9a, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18,
+	0xa6, 0x02, 0x34, 0x00, 0x00, 0xdd, 0x00, 0x05, 0x02, 0x00, 0xde, 0x00, 0x05, 0x02, 0x00, 0xdf,
+	0x00, 0x05, 0x02, 0x00, 0xe0, 0x00, 0x05, 0x02, 0x00, 0xe1, 0x00, 0x05, 0x02, 0x00, 0xe2, 0x00,
+	0x05, 0x02, 0x00, 0xe3, 0x00, 0x05, 0x02, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0xaa, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xcc, 0x00,
+	0x07, 0x98, 0x2e, 0x00, 0x00, 0x00, 0x05, 0x01, 0x19, 0x02, 0x96, 0x02, 0x97, 0x02, 0x00, 0x11,
+	0x00, 0x05, 0x01, 0x2e, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44,
+	0x00, 0x1c, 0x01, 0x98, 0x02, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x1c,
+	0x01, 0x98, 0x02, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x2a, 0x30,
+	0x07, 0x61, 0x2e, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x54, 0x2f, 0x71, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x5f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x09, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0x9c, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0xa8, 0x2f, 0xdc, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xb8, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x2f, 0xb8, 0x2f, 0xb3, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x9f, 0x00, 0x00, 0x00, 0x06, 0x05, 0x32, 0x38, 0x00, 0x06, 0x05, 0x32,
+	0x38, 0x03, 0x06, 0x05, 0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x38, 0x03, 0x06, 0x05, 0x32, 0x38,
+	0x00, 0x06, 0x05, 0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x07, 0xb8, 0x2f, 0x18, 0x07, 0x00, 0x0f,
+	0xde, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0x28, 0x30, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0xa2, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x30, 0x51, 0x30, 0x00, 0x00, 0x00, 0x05, 0x01, 0x1d, 0x07, 0xba,
+	0x79, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x94, 0x30, 0x71, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x09, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0xa5, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0xe8, 0x30, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0x30, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xa9, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x44, 0x31, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4a, 0x31, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00,
+	0x01, 0x00, 0x05, 0x03, 0x00, 0x02, 0x00, 0x05, 0x03, 0x07, 0x4a, 0x31, 0x53, 0x43, 0x50, 0x45,
+	0x1b, 0x00, 0x00, 0x00, 0x9c, 0x31, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xa7, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xad, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xac, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xf0, 0x31, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x31, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0x03, 0x32, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x09, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xb0, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0xaf, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x1b, 0x00, 0x00, 0x00, 0x4c, 0x32, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x07, 0x52, 0x32, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x94, 0x32, 0x83, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x32, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0xa7, 0x32, 0x09, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0xb5, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xb4, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x32, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x07, 0xbc, 0x32, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x33, 0x71, 0x79,
+	0x27, 0x33, 0x27, 0x33, 0x00, 0x00, 0x36, 0x33, 0x36, 0x33, 0x00, 0x00, 0x3b, 0x33, 0x3b, 0x33,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x1f, 0x33, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x09, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0xb9, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x05, 0x01, 0x26, 0x2a, 0x30, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x07, 0x19, 0x33, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0x54, 0x33, 0x20, 0x79, 0x00, 0x00, 0x00, 0x08, 0x67, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xa0, 0x33, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0xab, 0x33, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x09, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xbb, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0xe8, 0x33, 0xfb, 0x33,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x33, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xf3, 0x33, 0x09, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0xbe, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x07, 0x00, 0x08, 0xd7,
+	0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x46, 0x34,
+	0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x51, 0x34, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0xc1, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00,
+	0x00, 0x00, 0x9a, 0x34, 0xb5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xad, 0x34, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0x09, 0xc6, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xc4, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xc5, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x07, 0x00, 0x08, 0xd7, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x35, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x35, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0x13, 0x35, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x35,
+	0x09, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xc8, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0xc9, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x1b, 0x00, 0x00, 0x00, 0x5c, 0x35, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x67, 0x35,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x09, 0xce, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xcd, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xb0, 0x35, 0x71, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0xbb, 0x35, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x09, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xd1, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x35, 0x39, 0x36,
+	0x40, 0x00, 0x00, 0x05, 0x01, 0x40, 0x01, 0x00, 0x05, 0x01, 0x40, 0x02, 0x00, 0x05, 0x01, 0x40,
+	0x03, 0x00, 0x05, 0x01, 0x40, 0x04, 0x00, 0x05, 0x01, 0x40, 0x05, 0x00, 0x05, 0x01, 0x40, 0x06,
+	0x00, 0x05, 0x01, 0x40, 0x07, 0x00, 0x05, 0x01, 0x40, 0x08, 0x00, 0x05, 0x01, 0x40, 0x09, 0x00,
+	0x05, 0x01, 0x40, 0x0a, 0x00, 0x05, 0x01, 0x40, 0x0b, 0x00, 0x05, 0x01, 0x40, 0x0c, 0x00, 0x05,
+	0x01, 0x40, 0x0d, 0x00, 0x05, 0x01, 0x40, 0x0e, 0x00, 0x05, 0x01, 0x40, 0x0f, 0x00, 0x05, 0x01,
+	0x40, 0x10, 0x00, 0x05, 0x01, 0x40, 0x11, 0x00, 0x05, 0x01, 0x40, 0x12, 0x00, 0x05, 0x01, 0x40,
+	0x13, 0x00, 0x24, 0x01, 0x05, 0x01, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x66, 0x36, 0xb4, 0x36, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xa5, 0x36, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a,
+	0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00,
+	0x05, 0x01, 0x07, 0x84, 0x36, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x24,
+	0x01, 0x07, 0xba, 0x79, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05,
+	0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00,
+	0x05, 0x02, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x08, 0x37, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x37, 0x08, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x07, 0x08, 0x37, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x52, 0x37,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x58, 0x37, 0x52, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00,
+	0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x07, 0x58, 0x37, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xac, 0x37, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x37,
+	0xac, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x18, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x07, 0xb2, 0x37,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x38,
+	0x1c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x22, 0x38, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0x6c, 0x38, 0x9b, 0x38, 0x00, 0x00, 0xc4, 0x38, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x77, 0x38, 0x00, 0x00, 0xa6, 0x38, 0x77, 0x38, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x03, 0x00, 0x11,
+	0x00, 0x05, 0x03, 0x00, 0x22, 0x00, 0x03, 0x01, 0x05, 0x03, 0x00, 0x33, 0x00, 0x03, 0x02, 0x05,
+	0x03, 0x00, 0x44, 0x00, 0x03, 0x01, 0x05, 0x03, 0x07, 0x77, 0x38, 0x18, 0x08, 0x03, 0x08, 0x03,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00,
+	0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05,
+	0x02, 0x07, 0xa8, 0x38, 0x18, 0x0a, 0x03, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x05, 0x01, 0x25, 0x02,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3b, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x38, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0x4c, 0x39, 0x60, 0x39, 0xbb, 0x39, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x39, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0x39, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x39, 0x51, 0x39, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x06, 0x19, 0x1e, 0x00, 0x22, 0x00, 0x06, 0x19, 0x1e, 0x07, 0x51, 0x39,
+	0x18, 0x11, 0x03, 0x11, 0x86, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x35, 0x89, 0x39, 0x35, 0x89,
+	0x39, 0x06, 0x03, 0x06, 0x35, 0x89, 0x39, 0x06, 0x03, 0x06, 0x35, 0x89, 0x39, 0x35, 0x89, 0x39,
+	0x35, 0x89, 0x39, 0x06, 0x03, 0x06, 0x07, 0x6b, 0x39, 0x29, 0x08, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x29, 0x08, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x08,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x08, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x77, 0x00, 0x05, 0x01,
+	0x2e, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x1c, 0x01, 0x12, 0x03, 0x05, 0x01, 0x00,
+	0xaa, 0x00, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x07, 0x51, 0x39, 0x53, 0x43,
+	0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xea, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x32, 0x00,
+	0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00, 0x03, 0x00, 0x05, 0x32, 0x00, 0x04,
+	0x00, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0x44, 0x3a, 0x5b, 0x3a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x90, 0x3a, 0x49, 0x3a, 0x4f, 0x3a, 0xf3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x3a,
+	0xf9, 0x3a, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x25,
+	0x01, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x18, 0x43, 0x00, 0x34, 0x00,
+	0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xef, 0x00, 0x05, 0x01, 0x00, 0xf0, 0x00, 0x05, 0x01, 0x00,
+	0xf1, 0x00, 0x05, 0x01, 0x00, 0xf2, 0x00, 0x05, 0x01, 0x00, 0xf3, 0x00, 0x05, 0x01, 0x00, 0xf4,
+	0x00, 0x05, 0x01, 0x00, 0xf5, 0x00, 0x05, 0x01, 0x11, 0xec, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16,
+	0x29, 0x06, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x06,
+	0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x06, 0x05, 0x01,
+	0x00, 0x55, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x77,
+	0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x00, 0x00, 0x07, 0x90, 0x3a, 0x08, 0xa7, 0x01, 0x00, 0x00,
+	0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x00,
+	0xbb, 0x00, 0x05, 0x01, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x24, 0x04,
+	0x07, 0xba, 0x79, 0x00, 0xdd, 0x00, 0x07, 0xba, 0x79, 0x06, 0x01, 0x05, 0x09, 0xa7, 0x01, 0x00,
+	0x00, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x05, 0x01,
+	0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x24, 0x04, 0x07,
+	0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0x62, 0x3b, 0x84, 0x3b, 0xe0, 0x3b,
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x3b, 0x00, 0x00, 0xee, 0x3b, 0x6d, 0x3b, 0x00, 0x00, 0x00, 0x00,
+	0xa5, 0x3b, 0x6d, 0x3b, 0x00, 0x00, 0x2e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x3c, 0x34, 0x3c,
+	0x00, 0x00, 0x09, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04, 0x00, 0x00, 0x00,
+	0x05, 0x03, 0x00, 0x11, 0x00, 0x05, 0x03, 0x00, 0x22, 0x00, 0x05, 0x03, 0x00, 0x11, 0x00, 0x05,
+	0x03, 0x07, 0x6d, 0x3b, 0x18, 0x2f, 0x03, 0x34, 0x00, 0x00, 0x88, 0x00, 0x05, 0x02, 0x00, 0x99,
+	0x00, 0x05, 0x02, 0x00, 0xaa, 0x00, 0x05, 0x02, 0x00, 0xbb, 0x00, 0x05, 0x02, 0x11, 0x8b, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x07, 0xa5, 0x3b,
+	0x18, 0x6e, 0x00, 0x0d, 0x06, 0x02, 0x00, 0x00, 0x25, 0x01, 0x2a, 0x07, 0x6d, 0x3b, 0x00, 0x00,
+	0x00, 0x2e, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x11,
+	0x00, 0x05, 0x01, 0x27, 0x2f, 0x2a, 0x24, 0x02, 0x07, 0x6d, 0x3b, 0x08, 0xa7, 0x01, 0x00, 0x00,
+	0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00,
+	0xff, 0x00, 0x05, 0x01, 0x00, 0x10, 0x01, 0x05, 0x01, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x10,
+	0x01, 0x07, 0xba, 0x79, 0x06, 0x01, 0x05, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x05,
+	0x01, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x00, 0xcc, 0x00, 0x05, 0x01,
+	0x24, 0x04, 0x07, 0x6d, 0x3b, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x62, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05,
+	0x32, 0x00, 0x03, 0x00, 0x05, 0x32, 0x00, 0x04, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x1a, 0x00, 0x00, 0x00, 0xbc, 0x3c, 0xc7, 0x3c, 0x1a, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3d,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3c, 0xba, 0x79, 0x00, 0x00,
+	0x70, 0x3d, 0x2b, 0x3d, 0x00, 0x00, 0xfc, 0x3c, 0x9a, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x3d, 0x76, 0x3d, 0x00, 0x00, 0x09, 0x12, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x41, 0x03, 0x34, 0x00, 0x00, 0xaa, 0x00, 0x05,
+	0x02, 0x00, 0xbb, 0x00, 0x05, 0x02, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0xdd, 0x00, 0x05, 0x02,
+	0x00, 0xee, 0x00, 0x05, 0x02, 0x00, 0xff, 0x00, 0x05, 0x02, 0x00, 0x10, 0x01, 0x05, 0x02, 0x00,
+	0x21, 0x01, 0x05, 0x02, 0x11, 0x8d, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00,
+	0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x07, 0xfe, 0x3c, 0x03, 0x00, 0x18, 0x40, 0x00, 0x15,
+	0x4c, 0x01, 0x00, 0x05, 0x01, 0x25, 0x01, 0x2a, 0x07, 0xba, 0x79, 0x03, 0x00, 0x06, 0x05, 0x08,
+	0x18, 0x4f, 0x03, 0x00, 0x55, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00, 0x77, 0x00,
+	0x05, 0x02, 0x00, 0x88, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x07, 0x2b, 0x3d, 0x08, 0xa7, 0x01,
+	0x00, 0x00, 0x00, 0x32, 0x01, 0x05, 0x01, 0x00, 0x43, 0x01, 0x05, 0x01, 0x00, 0x54, 0x01, 0x05,
+	0x01, 0x00, 0x65, 0x01, 0x05, 0x01, 0x00, 0x76, 0x01, 0x05, 0x01, 0x24, 0x04, 0x07, 0xba, 0x79,
+	0x00, 0x76, 0x01, 0x07, 0xba, 0x79, 0x06, 0x01, 0x05, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x65,
+	0x01, 0x05, 0x01, 0x00, 0x54, 0x01, 0x05, 0x01, 0x00, 0x43, 0x01, 0x05, 0x01, 0x00, 0x32, 0x01,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x24, 0x04, 0x07, 0xba, 0x79, 0x24, 0x10, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xac, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00, 0x03, 0x00, 0x05, 0x32,
+	0x00, 0x04, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xea, 0x3d,
+	0x73, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x3e, 0x09, 0x16, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x05, 0x02, 0x00, 0x15, 0x00, 0x05, 0x02, 0x00, 0x16, 0x00, 0x05, 0x02, 0x00, 0x17,
+	0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00,
+	0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05,
+	0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02,
+	0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x07,
+	0x03, 0x3e, 0x05, 0x01, 0x2e, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00,
+	0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11,
+	0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00, 0x13, 0x00, 0x05, 0x02, 0x24, 0x04, 0x2f,
+	0x07, 0xba, 0x79, 0x18, 0x3e, 0x03, 0x11, 0x8f, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x19, 0x00, 0x0a, 0x00, 0x05,
+	0x19, 0x00, 0x0b, 0x00, 0x05, 0x19, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0xec, 0x3e, 0x1d, 0x3f, 0x4e, 0x3f, 0x4e, 0x3f, 0x00, 0x00, 0x4e, 0x3f, 0x4e, 0x3f, 0x00, 0x00,
+	0xf7, 0x3e, 0xf7, 0x3e, 0x00, 0x00, 0x28, 0x3f, 0xf7, 0x3e, 0x00, 0x00, 0x09, 0x1a, 0x00, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05,
+	0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02,
+	0x00, 0x55, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x07, 0xf7, 0x3e, 0x18, 0x54, 0x03,
+	0x08, 0x1c, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05,
+	0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x07, 0x28, 0x3f, 0x18, 0x47,
+	0x00, 0x0d, 0x06, 0x02, 0x00, 0x00, 0x25, 0x01, 0x2a, 0x07, 0xf7, 0x3e, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x68, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3a, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0xb6, 0x3f,
+	0x50, 0x40, 0xb9, 0x40, 0xb9, 0x40, 0x00, 0x00, 0xce, 0x40, 0xce, 0x40, 0x00, 0x00, 0xe5, 0x40,
+	0xe5, 0x40, 0x00, 0x00, 0x85, 0x40, 0xbb, 0x3f, 0x00, 0x00, 0x1a, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf7, 0x40, 0x20, 0x41, 0x00, 0x00, 0x09, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x06, 0x3f,
+	0x4b, 0x1e, 0x19, 0xcc, 0x3f, 0x1e, 0x80, 0xf2, 0x3f, 0x07, 0xbe, 0x3f, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x19,
+	0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07,
+	0xbb, 0x3f, 0x1e, 0x80, 0x23, 0x40, 0x00, 0x66, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x77, 0x00,
+	0x05, 0x01, 0x1f, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01,
+	0x1f, 0x01, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x1f, 0x01,
+	0x07, 0xbb, 0x3f, 0x00, 0x66, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x20,
+	0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00,
+	0xaa, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x20, 0x01, 0x07, 0xbb, 0x3f,
+	0x18, 0x63, 0x03, 0x34, 0x00, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0xcd, 0x00, 0x05, 0x02, 0x00,
+	0xce, 0x00, 0x05, 0x02, 0x00, 0xcf, 0x00, 0x05, 0x02, 0x00, 0xd0, 0x00, 0x05, 0x02, 0x00, 0xd1,
+	0x00, 0x05, 0x02, 0x00, 0xd2, 0x00, 0x05, 0x02, 0x00, 0xd3, 0x00, 0x05, 0x02, 0x11, 0x93, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x02, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x02, 0x05, 0x01,
+	0x00, 0x77, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x99,
+	0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29,
+	0x02, 0x05, 0x01, 0x00, 0x55, 0x00, 0x07, 0x85, 0x40, 0x00, 0x00, 0x00, 0x05, 0x01, 0x2e, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x05, 0x01,
+	0x00, 0x44, 0x00, 0x18, 0x40, 0x00, 0x15, 0x4c, 0x01, 0x00, 0x26, 0x05, 0x01, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x2f, 0x2a, 0x30, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x07, 0xbb, 0x3f, 0x08, 0xa7, 0x01, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x05,
+	0x01, 0x00, 0xe5, 0x00, 0x05, 0x01, 0x00, 0xf6, 0x00, 0x05, 0x01, 0x00, 0x07, 0x01, 0x05, 0x01,
+	0x00, 0x18, 0x01, 0x05, 0x01, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x18, 0x01, 0x07, 0xba, 0x79,
+	0x06, 0x01, 0x05, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x05, 0x01, 0x00, 0xf6, 0x00,
+	0x05, 0x01, 0x00, 0xe5, 0x00, 0x05, 0x01, 0x00, 0xd4, 0x00, 0x05, 0x01, 0x24, 0x04, 0x07, 0xbb,
+	0x3f, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00, 0x03, 0x00,
+	0x05, 0x32, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x88, 0x41, 0x8e, 0x41,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x99, 0x41, 0x88, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x51,
+	0x03, 0x11, 0x96, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x02, 0x05, 0x01, 0x00, 0x00, 0x00,
+	0x29, 0x02, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x02,
+	0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x44, 0x00, 0x07, 0x99, 0x41, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x19, 0x00,
+	0x07, 0x00, 0x05, 0x19, 0x00, 0x08, 0x00, 0x05, 0x19, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x1e, 0x42, 0x45, 0x42, 0x6c, 0x42, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x6c, 0x42,
+	0x00, 0x00, 0x29, 0x42, 0x29, 0x42, 0x00, 0x00, 0x50, 0x42, 0x29, 0x42, 0x00, 0x00, 0x09, 0x27,
+	0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11,
+	0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00,
+	0x05, 0x02, 0x07, 0x29, 0x42, 0x18, 0xae, 0x03, 0x08, 0x29, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00,
+	0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x07, 0x50, 0x42, 0x18, 0x71, 0x00, 0x05,
+	0x01, 0x25, 0x01, 0x2a, 0x07, 0x29, 0x42, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x84, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3b, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0xb6, 0x42, 0xc1, 0x42, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xcc, 0x42, 0xe5, 0x42, 0x00, 0x00, 0x09, 0x2b, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2,
+	0x79, 0x18, 0x8e, 0x03, 0x08, 0x2d, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00,
+	0x05, 0x02, 0x07, 0xd8, 0x42, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00,
+	0x11, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0xa2, 0x79, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3a, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0x43,
+	0x61, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x00, 0x00, 0x8a, 0x43, 0x8a, 0x43, 0xb1, 0x43, 0x45, 0x43,
+	0x45, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x45, 0x43, 0x00, 0x00, 0x09, 0x2f, 0x00, 0x00, 0x2a, 0x00,
+	0x00, 0x00, 0x06, 0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00,
+	0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x07, 0x45,
+	0x43, 0x1a, 0x9d, 0x03, 0x9f, 0x03, 0x0f, 0x9c, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x07, 0x6e, 0x43, 0x03, 0x00, 0x00, 0x55, 0x00, 0x05,
+	0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x18, 0x5a,
+	0x00, 0x25, 0x01, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x2a, 0x07, 0x45,
+	0x43, 0x03, 0x00, 0x00, 0x55, 0x00, 0x2e, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00, 0x77,
+	0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x27, 0x24, 0x02, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01,
+	0x00, 0xaa, 0x00, 0x2f, 0x2a, 0x07, 0x45, 0x43, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0xe4, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3a, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x26, 0x44, 0x4d, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x44, 0x36, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x44, 0x3c, 0x44, 0x00, 0x00, 0x09, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x02, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04,
+	0x07, 0x3c, 0x44, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0x94, 0x44, 0xbc, 0x44,
+	0x02, 0x45, 0x02, 0x45, 0x00, 0x00, 0x11, 0x45, 0x11, 0x45, 0x5b, 0x45, 0x49, 0x45, 0x49, 0x45,
+	0x00, 0x00, 0xc7, 0x44, 0x99, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x45,
+	0xb7, 0x45, 0x00, 0x00, 0x09, 0x22, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x06, 0x3f, 0x4b, 0x1e,
+	0x80, 0xa6, 0x44, 0x07, 0x9c, 0x44, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01,
+	0x22, 0x03, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x07, 0x99, 0x44, 0x18, 0xc7, 0x03, 0x08,
+	0xe7, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0xcc, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xee,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xff, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x07,
+	0xc7, 0x44, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05,
+	0x02, 0x2e, 0x18, 0x70, 0x00, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x00,
+	0x55, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00, 0x77, 0x00, 0x1c, 0x01, 0x00, 0x00,
+	0x05, 0x03, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05,
+	0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x2f, 0x2a, 0x30, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x11,
+	0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0x99, 0x44, 0x00, 0x00, 0x00, 0x2e, 0x05,
+	0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01,
+	0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00,
+	0x77, 0x00, 0x27, 0x24, 0x02, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05,
+	0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x2a, 0x07, 0xba, 0x79, 0x08, 0xa7, 0x01,
+	0x00, 0x00, 0x24, 0x04, 0x07, 0xba, 0x79, 0x06, 0x01, 0x05, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0xec, 0x45, 0x96, 0x46, 0x1e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x21, 0x47, 0x00, 0x00, 0x00, 0x00,
+	0xf1, 0x45, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x46, 0xf1, 0x45, 0x00, 0x00, 0x09, 0x33, 0x00, 0x00,
+	0x00, 0x00, 0x99, 0x00, 0x07, 0xba, 0x79, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x05,
+	0x01, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x07, 0xf1, 0x45, 0x1e, 0x80,
+	0x54, 0x46, 0x00, 0x99, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x22, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x33,
+	0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x44, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x55, 0x00, 0x1f,
+	0x01, 0x05, 0x01, 0x00, 0x66, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x00, 0x77, 0x00, 0x1f, 0x01, 0x05,
+	0x01, 0x07, 0xf1, 0x45, 0x00, 0x99, 0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x20, 0x01,
+	0x05, 0x01, 0x00, 0x11, 0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x22, 0x00, 0x20, 0x01, 0x05, 0x01,
+	0x00, 0x33, 0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x44, 0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x55,
+	0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x66, 0x00, 0x20, 0x01, 0x05, 0x01, 0x00, 0x77, 0x00, 0x20,
+	0x01, 0x05, 0x01, 0x07, 0xf1, 0x45, 0x18, 0x6e, 0x03, 0x34, 0x00, 0x00, 0xff, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x01, 0x05, 0x02, 0x00, 0x01, 0x01, 0x05, 0x02, 0x00, 0x02, 0x01, 0x05, 0x02, 0x00,
+	0x03, 0x01, 0x05, 0x02, 0x00, 0x04, 0x01, 0x05, 0x02, 0x00, 0x05, 0x01, 0x05, 0x02, 0x00, 0x06,
+	0x01, 0x05, 0x02, 0x00, 0x07, 0x01, 0x05, 0x02, 0x00, 0x08, 0x01, 0x05, 0x02, 0x11, 0x9e, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x02, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x06, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x03, 0x05, 0x01, 0x00, 0x33,
+	0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x07, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29,
+	0x08, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x07, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x08, 0x05,
+	0x01, 0x00, 0x88, 0x00, 0x29, 0x07, 0x05, 0x01, 0x00, 0x99, 0x00, 0x07, 0xd5, 0x46, 0x00, 0xee,
+	0x00, 0x05, 0x01, 0x2e, 0x19, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x05, 0x02, 0x00, 0xdd,
+	0x00, 0x05, 0x02, 0x00, 0xcc, 0x00, 0x1c, 0x02, 0x7e, 0x03, 0x7f, 0x03, 0x05, 0x02, 0x00, 0xbb,
+	0x00, 0x05, 0x02, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0xdd, 0x00, 0x05, 0x02, 0x00, 0xee, 0x00,
+	0x05, 0x02, 0x2f, 0x2a, 0x07, 0xf1, 0x45, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x64, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02,
+	0x00, 0x05, 0x32, 0x00, 0x03, 0x00, 0x05, 0x32, 0x00, 0x04, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00,
+	0x01, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x04,
+	0x00, 0x05, 0x05, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0xe4, 0x47, 0xef, 0x47,
+	0x53, 0x48, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x47, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x48, 0xe9, 0x47, 0x00, 0x00, 0x99, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x48,
+	0x9f, 0x48, 0x00, 0x00, 0x09, 0x37, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0xba, 0x79, 0x18,
+	0x80, 0x03, 0x34, 0x00, 0x00, 0x21, 0x01, 0x05, 0x02, 0x00, 0x22, 0x01, 0x05, 0x02, 0x00, 0x23,
+	0x01, 0x05, 0x02, 0x00, 0x24, 0x01, 0x05, 0x02, 0x00, 0x25, 0x01, 0x05, 0x02, 0x00, 0x26, 0x01,
+	0x05, 0x02, 0x00, 0x27, 0x01, 0x05, 0x02, 0x11, 0xa0, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29,
+	0x02, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x09, 0x05,
+	0x01, 0x00, 0x88, 0x00, 0x29, 0x05, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00,
+	0xaa, 0x00, 0x29, 0x07, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x02, 0x05, 0x01, 0x00, 0x55, 0x00,
+	0x07, 0x1f, 0x48, 0x00, 0x00, 0x00, 0x05, 0x01, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22,
+	0x00, 0x1c, 0x01, 0x7e, 0x03, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05,
+	0x01, 0x2f, 0x2a, 0x07, 0xe9, 0x47, 0x08, 0xa7, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x05, 0x01,
+	0x00, 0xdd, 0x00, 0x05, 0x01, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xff, 0x00, 0x05, 0x01, 0x00,
+	0x10, 0x01, 0x05, 0x01, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x10, 0x01, 0x07, 0xba, 0x79, 0x06,
+	0x01, 0x05, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x05, 0x01, 0x00, 0xee, 0x00, 0x05,
+	0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x24, 0x04, 0x07, 0xe9, 0x47,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00, 0x03, 0x00, 0x05, 0x32,
+	0x00, 0x04, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x1a, 0x49,
+	0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x49, 0x2a, 0x49,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x49, 0x30, 0x49, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03,
+	0x00, 0x01, 0x00, 0x05, 0x03, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x05, 0x03, 0x07,
+	0x30, 0x49, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x76, 0x49, 0x4d, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x49, 0x81, 0x49, 0x00, 0x00, 0x00, 0x00,
+	0x87, 0x49, 0x87, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x41, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x07, 0x87, 0x49, 0x08, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0x49, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0xde, 0x49, 0x35, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0x49, 0xee, 0x49, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x49, 0xf4, 0x49, 0x00, 0x00, 0x09, 0x5e,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x38, 0x00, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00,
+	0x05, 0x02, 0x07, 0xf4, 0x49, 0x18, 0x06, 0x03, 0x0f, 0xb9, 0x00, 0x00, 0x00, 0x05, 0x03, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x74, 0x4a, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x4a, 0x84, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0x00, 0x00, 0x09, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0x8a,
+	0x4a, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xd6, 0x4a, 0x5f, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x4a, 0xe6, 0x4a, 0x00, 0x00, 0x00, 0x00,
+	0xec, 0x4a, 0xec, 0x4a, 0x00, 0x00, 0x09, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0xec, 0x4a, 0x05, 0x0a, 0x05,
+	0x0a, 0x05, 0x0a, 0x05, 0x0a, 0x07, 0xec, 0x4a, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0x4c, 0x4b, 0x5f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x4b,
+	0x5c, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x62, 0x4b, 0x62, 0x4b, 0x00, 0x00, 0x09, 0x49, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05,
+	0x04, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04,
+	0x07, 0x62, 0x4b, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xb8, 0x4b, 0x38, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xec, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x4b, 0xf2, 0x4b,
+	0xd0, 0x4b, 0xc8, 0x4b, 0xc2, 0x4b, 0x00, 0x00, 0x09, 0x15, 0x01, 0x00, 0x00, 0x08, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x14, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x2e, 0x18, 0xd7, 0x01, 0x00, 0x05, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x04, 0x00, 0x07,
+	0xba, 0x79, 0x2e, 0x05, 0x12, 0x18, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x05, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x24,
+	0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x4a, 0x4c,
+	0x5f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x4c, 0x5a, 0x4c,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x4c, 0x60, 0x4c, 0x00, 0x00, 0x09, 0x4b, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0x60,
+	0x4c, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xb6, 0x4c, 0x4d, 0x79, 0xde, 0x4c,
+	0x00, 0x00, 0x00, 0x00, 0xde, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x56, 0x4d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x4c, 0xc6, 0x4c, 0x00, 0x00, 0x00, 0x00,
+	0xcc, 0x4c, 0xcc, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4d, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x02, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x07, 0xcc, 0x4c, 0x3b, 0x4a,
+	0x00, 0x2a, 0x00, 0x59, 0x4d, 0x3b, 0x9f, 0x00, 0x2a, 0x00, 0xd0, 0x4d, 0x2e, 0x18, 0x4e, 0x00,
+	0x00, 0x18, 0x00, 0x05, 0x01, 0x00, 0x19, 0x00, 0x05, 0x01, 0x00, 0x1a, 0x00, 0x05, 0x01, 0x00,
+	0x1b, 0x00, 0x05, 0x01, 0x00, 0x1c, 0x00, 0x05, 0x01, 0x00, 0x1d, 0x00, 0x05, 0x01, 0x00, 0x1e,
+	0x00, 0x05, 0x01, 0x00, 0x1f, 0x00, 0x05, 0x01, 0x00, 0x20, 0x00, 0x05, 0x01, 0x00, 0x21, 0x00,
+	0x05, 0x01, 0x25, 0x01, 0x05, 0x06, 0x00, 0x20, 0x00, 0x05, 0x01, 0x00, 0x1f, 0x00, 0x05, 0x01,
+	0x00, 0x1e, 0x00, 0x05, 0x01, 0x00, 0x1d, 0x00, 0x05, 0x01, 0x00, 0x1c, 0x00, 0x05, 0x01, 0x00,
+	0x1b, 0x00, 0x05, 0x01, 0x00, 0x1a, 0x00, 0x05, 0x01, 0x00, 0x19, 0x00, 0x05, 0x01, 0x00, 0x18,
+	0x00, 0x05, 0x01, 0x2f, 0x2a, 0x30, 0x07, 0xcc, 0x4c, 0x2e, 0x18, 0x4e, 0x00, 0x00, 0x03, 0x00,
+	0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05,
+	0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01,
+	0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00,
+	0x0d, 0x00, 0x05, 0x01, 0x25, 0x01, 0x05, 0x06, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00,
+	0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05,
+	0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x30, 0x07, 0xcc, 0x4c,
+	0x2e, 0x18, 0x4e, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x10,
+	0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x00, 0x13, 0x00,
+	0x05, 0x01, 0x00, 0x14, 0x00, 0x05, 0x01, 0x00, 0x15, 0x00, 0x05, 0x01, 0x00, 0x16, 0x00, 0x05,
+	0x01, 0x00, 0x17, 0x00, 0x05, 0x01, 0x25, 0x01, 0x05, 0x06, 0x00, 0x17, 0x00, 0x05, 0x01, 0x00,
+	0x16, 0x00, 0x05, 0x01, 0x00, 0x15, 0x00, 0x05, 0x01, 0x00, 0x14, 0x00, 0x05, 0x01, 0x00, 0x13,
+	0x00, 0x05, 0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00,
+	0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x0e, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x30, 0x07,
+	0xcc, 0x4c, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x76, 0x4e, 0x4d, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x4e, 0x86, 0x4e, 0x00, 0x00, 0x00, 0x00,
+	0x8c, 0x4e, 0x8c, 0x4e, 0x00, 0x00, 0x09, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x07, 0x8c, 0x4e, 0x53, 0x43,
+	0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xd2, 0x4e, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xdd, 0x4e, 0xe2, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x4e, 0xe8, 0x4e,
+	0x00, 0x00, 0x09, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00,
+	0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0xe8, 0x4e, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x34, 0x4f, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x4f, 0x44, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4f,
+	0x4a, 0x4f, 0x00, 0x00, 0x09, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x04, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0x4a,
+	0x4f, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x96, 0x4f, 0x4d, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x4f, 0xa6, 0x4f, 0x00, 0x00, 0x00, 0x00,
+	0xac, 0x4f, 0xac, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x57, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0xac, 0x4f, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x02, 0x50, 0x36, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x50, 0x08, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x50, 0x0b, 0x50,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x06, 0x01, 0x03, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04, 0x05, 0x01, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0x0b, 0x50, 0x08, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x08, 0x50, 0x18, 0x06, 0x03, 0x08, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x03,
+	0x08, 0x59, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0x88, 0x50, 0x5f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x50,
+	0x8e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x91, 0x50, 0x91, 0x50, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xbc, 0x50, 0x5f, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x06, 0x01,
+	0x03, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04,
+	0x05, 0x01, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0x91,
+	0x50, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8e, 0x50, 0x00, 0x00, 0x00, 0x05,
+	0x3f, 0x07, 0x5f, 0x79, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xf8, 0x50, 0x4d, 0x79,
+	0x00, 0x00, 0xc8, 0x79, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x51,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x51, 0x0b, 0x51, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x51, 0x0e, 0x51, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00,
+	0x05, 0x02, 0x07, 0x0e, 0x51, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x5a, 0x51,
+	0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x51, 0x6a, 0x51,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x51, 0x70, 0x51, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x00, 0x05, 0x04, 0x07, 0x70, 0x51, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0xbc, 0x51, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x51,
+	0xcc, 0x51, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x51, 0xd2, 0x51, 0x00, 0x00, 0x09, 0x62, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x03, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x01, 0x00, 0x05,
+	0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0xd2, 0x51, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x1e, 0x52, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x29, 0x52, 0x2e, 0x52, 0x00, 0x00, 0x00, 0x00, 0x34, 0x52, 0x34, 0x52, 0x00, 0x00, 0x09, 0x3e,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x03, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x07, 0x34, 0x52,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x5c, 0x52, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x07, 0x5c, 0x52, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x80, 0x52, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x08, 0x63, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x0d, 0x00, 0x00, 0x00, 0xb0, 0x52, 0xe7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x52,
+	0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00,
+	0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x24, 0x04, 0x11, 0x3f,
+	0x01, 0x00, 0x00, 0x2f, 0x07, 0xba, 0x79, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0e, 0x00,
+	0x00, 0x00, 0x36, 0x53, 0xeb, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x53, 0x8f, 0x53,
+	0x00, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xb2, 0x53, 0xeb, 0x53, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x53, 0x09, 0x0c, 0x00, 0x00, 0x2a, 0x00, 0x09, 0x00, 0x05, 0x02,
+	0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00,
+	0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x06, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x07, 0x5a, 0x53, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00,
+	0x0e, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0b,
+	0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x24, 0x04, 0x07,
+	0xba, 0x79, 0x09, 0x0c, 0x00, 0x00, 0x2a, 0x07, 0x5a, 0x53, 0x05, 0x01, 0x2e, 0x00, 0x0f, 0x00,
+	0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05,
+	0x02, 0x00, 0x13, 0x00, 0x05, 0x02, 0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15, 0x00, 0x05, 0x02,
+	0x00, 0x16, 0x00, 0x05, 0x02, 0x24, 0x04, 0x2f, 0x07, 0xba, 0x79, 0x18, 0xae, 0x03, 0x08, 0x29,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x02, 0x54,
+	0x14, 0x54, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x07, 0x02, 0x54, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0f, 0x00, 0x00, 0x00,
+	0x40, 0x54, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0x54, 0x54, 0x89, 0x54,
+	0x09, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x07, 0x54, 0x54, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b,
+	0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x0f, 0x00, 0x00, 0x00, 0xc6, 0x54, 0x4d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x55, 0x0f, 0x55, 0x44, 0x55, 0x09, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08,
+	0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x07, 0xda, 0x54, 0x00,
+	0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10,
+	0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00,
+	0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05,
+	0x02, 0x07, 0x0f, 0x55, 0x00, 0x13, 0x00, 0x05, 0x02, 0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15,
+	0x00, 0x05, 0x02, 0x24, 0x04, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x0f, 0x00, 0x00, 0x00,
+	0xa8, 0x55, 0x5f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x55, 0x1c, 0x56, 0x51, 0x56,
+	0x53, 0x43, 0x50, 0x45, 0x0f, 0x00, 0x00, 0x00, 0x65, 0x56, 0x77, 0x56, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1c, 0x56, 0x1c, 0x56, 0x51, 0x56, 0x09, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02,
+	0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x07, 0xbc, 0x55, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05,
+	0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02,
+	0x00, 0x12, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00,
+	0x0f, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x07, 0xe7, 0x55, 0x00, 0x16, 0x00, 0x05,
+	0x02, 0x00, 0x17, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x05, 0x02, 0x00, 0x19, 0x00, 0x05, 0x02,
+	0x00, 0x1a, 0x00, 0x05, 0x02, 0x00, 0x1b, 0x00, 0x05, 0x02, 0x00, 0x1a, 0x00, 0x05, 0x02, 0x00,
+	0x19, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x05, 0x02, 0x00, 0x17, 0x00, 0x05, 0x02, 0x07, 0x1c,
+	0x56, 0x00, 0x1c, 0x00, 0x05, 0x02, 0x00, 0x1d, 0x00, 0x05, 0x02, 0x00, 0x1e, 0x00, 0x05, 0x02,
+	0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x07, 0x1c, 0x56, 0x18, 0x06, 0x03, 0x0f, 0xb9, 0x00, 0x00, 0x00, 0x05,
+	0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x56, 0x9e, 0x56, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x16, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xb2, 0x56, 0xc3, 0x56, 0xbb, 0x56,
+	0x00, 0x00, 0x18, 0x41, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x07, 0xbb, 0x56, 0x18, 0x09, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00,
+	0x00, 0x00, 0xda, 0x56, 0xff, 0x56, 0xe3, 0x56, 0x00, 0x00, 0x18, 0x63, 0x00, 0x05, 0x01, 0x24,
+	0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00,
+	0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x07, 0xe3, 0x56, 0x08,
+	0xab, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00,
+	0x18, 0x57, 0x2b, 0x57, 0x21, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05,
+	0x01, 0x0f, 0x35, 0x01, 0x00, 0x00, 0x05, 0x03, 0x07, 0x21, 0x57, 0x08, 0x2c, 0x02, 0x00, 0x00,
+	0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x44, 0x57, 0x87, 0x57,
+	0x4d, 0x57, 0x00, 0x00, 0x18, 0x63, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00,
+	0x0a, 0x00, 0x05, 0x01, 0x07, 0x4d, 0x57, 0x08, 0xab, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x57, 0xa6, 0x57, 0xa6, 0x57, 0x00, 0x00,
+	0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x18, 0x66, 0x02, 0x1b, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05,
+	0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00,
+	0xf8, 0x57, 0x0e, 0x58, 0x04, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xb3, 0x00, 0x05, 0x01,
+	0x24, 0x01, 0x05, 0x01, 0x05, 0x03, 0x14, 0x5f, 0x01, 0x00, 0x00, 0x07, 0x04, 0x58, 0x08, 0x20,
+	0x02, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x58, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33,
+	0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x44, 0x58, 0x5c, 0x58,
+	0x52, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x52, 0x00, 0x53, 0x00, 0x05, 0x01, 0x24, 0x01,
+	0x05, 0x01, 0x0f, 0x35, 0x01, 0x00, 0x00, 0x05, 0x02, 0x07, 0x52, 0x58, 0x18, 0x09, 0x00, 0x08,
+	0x12, 0x02, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00,
+	0x78, 0x58, 0xa2, 0x58, 0x84, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6a, 0x00, 0x05, 0x01,
+	0x24, 0x01, 0x05, 0x01, 0x0f, 0x36, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x07,
+	0x8b, 0x58, 0x08, 0xb8, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x02, 0x00, 0x00, 0x00, 0xbc, 0x58, 0xd0, 0x58, 0xc6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x50, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x02, 0x0f, 0x75, 0x01, 0x00, 0x00, 0x07, 0xc6, 0x58,
+	0x08, 0xba, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00,
+	0x00, 0x00, 0xea, 0x58, 0x00, 0x59, 0xf6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x00,
+	0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x0f, 0x35, 0x01, 0x00, 0x00, 0x05, 0x03, 0x07, 0xf6, 0x58,
+	0x18, 0x09, 0x00, 0x08, 0x12, 0x02, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x02, 0x00, 0x00, 0x00, 0x1c, 0x59, 0x26, 0x59, 0x23, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x24, 0x01, 0x07, 0xba, 0x79, 0x0f, 0x6d, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x40, 0x59, 0x46, 0x59, 0x46, 0x59, 0x00, 0x00,
+	0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05,
+	0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01,
+	0x00, 0x05, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x76, 0x59,
+	0x7c, 0x59, 0x7c, 0x59, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x18,
+	0x42, 0x00, 0x1b, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00,
+	0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06,
+	0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00,
+	0x00, 0x00, 0xba, 0x59, 0xc0, 0x59, 0xc0, 0x59, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01,
+	0x00, 0x00, 0x00, 0x1a, 0x23, 0x00, 0x27, 0x00, 0x1b, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00,
+	0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08,
+	0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00,
+	0x00, 0x00, 0x1e, 0x5a, 0x9c, 0x5a, 0x27, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x5a, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x0f,
+	0x6f, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x05, 0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05,
+	0x01, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x01, 0x07, 0x27, 0x5a, 0x1a, 0x5b,
+	0x00, 0x5c, 0x00, 0x0f, 0x6d, 0x01, 0x00, 0x00, 0x1b, 0x07, 0x27, 0x5a, 0x18, 0x5d, 0x00, 0x0f,
+	0x6d, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00,
+	0xb8, 0x5a, 0xf4, 0x5a, 0xc4, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x4e, 0x00, 0x05, 0x01,
+	0x24, 0x01, 0x05, 0x01, 0x0f, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x0f, 0x70,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x0f, 0x70, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x05, 0x01, 0x0f, 0x70, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x0f, 0x70, 0x01, 0x00,
+	0x00, 0x07, 0xc4, 0x5a, 0x18, 0x4f, 0x00, 0x0f, 0x6d, 0x01, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x10, 0x5b, 0x19, 0x5b, 0x19, 0x5b, 0x00, 0x00,
+	0x18, 0x4f, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01,
+	0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x01, 0x00, 0x05, 0x00, 0x1b, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x62, 0x5b, 0x68, 0x5b, 0x68, 0x5b,
+	0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x00, 0x09,
+	0x00, 0x05, 0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x00, 0x1b, 0x00, 0x05, 0x01, 0x00, 0x24, 0x00,
+	0x05, 0x01, 0x00, 0x2d, 0x00, 0x05, 0x01, 0x00, 0x36, 0x00, 0x05, 0x01, 0x00, 0x3f, 0x00, 0x05,
+	0x01, 0x00, 0x48, 0x00, 0x05, 0x01, 0x00, 0x51, 0x00, 0x05, 0x01, 0x00, 0x5a, 0x00, 0x05, 0x01,
+	0x00, 0x63, 0x00, 0x05, 0x01, 0x00, 0x6c, 0x00, 0x05, 0x01, 0x00, 0x75, 0x00, 0x05, 0x01, 0x00,
+	0x7e, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xc6, 0x5b,
+	0xcc, 0x5b, 0xcc, 0x5b, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x05, 0x1b, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xe6, 0x5b,
+	0xec, 0x5b, 0xec, 0x5b, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x1b,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x4a, 0x5c,
+	0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x5c, 0x55, 0x5c,
+	0xba, 0x79, 0xba, 0x79, 0x61, 0x5c, 0x55, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x01,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x08, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00,
+	0x00, 0x00, 0xa6, 0x5c, 0xb3, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb3, 0x5c, 0xb3, 0x5c, 0xa9, 0x5c, 0xb3, 0x5c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xb3, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x32, 0x06, 0x02, 0x05, 0x33,
+	0x07, 0xa9, 0x5c, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xf2, 0x5c,
+	0x38, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x4b, 0x5d, 0x00, 0x00, 0x03, 0x5d, 0xfd, 0x5c,
+	0x51, 0x5d, 0x2f, 0x5d, 0x09, 0x5d, 0xfd, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5d,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0b, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x00, 0x07, 0x00, 0x05, 0x04, 0x00, 0x08,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x04, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x07, 0x09, 0x5d, 0x2e,
+	0x18, 0xd7, 0x01, 0x00, 0x05, 0x00, 0x05, 0x08, 0x00, 0x02, 0x00, 0x05, 0x08, 0x00, 0x03, 0x00,
+	0x05, 0x08, 0x00, 0x04, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x04, 0x00, 0x07, 0xba,
+	0x79, 0x2e, 0x05, 0x0f, 0x18, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x05, 0x08, 0x00, 0x03, 0x00, 0x05,
+	0x08, 0x00, 0x02, 0x00, 0x05, 0x08, 0x00, 0x05, 0x00, 0x05, 0x08, 0x00, 0x00, 0x00, 0x24, 0x10,
+	0x2f, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0xac, 0x5d, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x5d,
+	0xb1, 0x5d, 0xba, 0x79, 0xba, 0x79, 0xb7, 0x5d, 0xb1, 0x5d, 0x00, 0x00, 0x09, 0x0e, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x0d, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x01, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x02, 0x5e,
+	0x14, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x5e, 0x14, 0x5e, 0x02, 0x5e, 0x14, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5e,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x01, 0x00, 0x05, 0x03, 0x00, 0x02, 0x00, 0x05,
+	0x03, 0x07, 0x02, 0x5e, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00,
+	0x4c, 0x5e, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x5e,
+	0x57, 0x5e, 0x68, 0x5e, 0xba, 0x79, 0xba, 0x79, 0x5c, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x12, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x10, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xb0, 0x5e, 0xd4, 0x5e,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5e,
+	0xc5, 0x5e, 0xbf, 0x5e, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x07, 0xba, 0x79, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00,
+	0x14, 0x5f, 0x51, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1a, 0x5f, 0xba, 0x79, 0x1c, 0x5f, 0x1c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x0d, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x07, 0x1c,
+	0x5f, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x88, 0x5f, 0x38, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xbd, 0x5f, 0x00, 0x00, 0x9b, 0x5f, 0x8d, 0x5f, 0xc3, 0x5f,
+	0xa1, 0x5f, 0x93, 0x5f, 0x8d, 0x5f, 0x00, 0x00, 0x09, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x14, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba,
+	0x79, 0x2e, 0x18, 0xd7, 0x01, 0x00, 0x05, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00,
+	0x03, 0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x04, 0x00,
+	0x07, 0xba, 0x79, 0x2e, 0x05, 0x12, 0x18, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x05, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00,
+	0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x22, 0x60,
+	0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x60, 0x70, 0x60, 0x22, 0x60, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x05, 0x04, 0x32, 0x05, 0x01, 0x33, 0x05, 0x01, 0x32, 0x05,
+	0x01, 0x33, 0x05, 0x03, 0x32, 0x05, 0x01, 0x33, 0x05, 0x03, 0x32, 0x05, 0x01, 0x33, 0x05, 0x04,
+	0x32, 0x05, 0x01, 0x33, 0x05, 0x01, 0x32, 0x05, 0x01, 0x33, 0x05, 0x03, 0x32, 0x05, 0x01, 0x33,
+	0x05, 0x03, 0x32, 0x05, 0x01, 0x33, 0x05, 0x04, 0x32, 0x05, 0x01, 0x33, 0x05, 0x03, 0x32, 0x05,
+	0x01, 0x33, 0x05, 0x01, 0x32, 0x05, 0x01, 0x33, 0x05, 0x01, 0x32, 0x05, 0x01, 0x07, 0x22, 0x60,
+	0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xb0, 0x60, 0x23, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x60, 0xbb, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x60, 0x00, 0x00,
+	0x09, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x17, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x61, 0x2d, 0x61, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x61,
+	0x0c, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x07, 0x0c, 0x61, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x61, 0x71, 0x61, 0x85, 0x61, 0xba, 0x79, 0x77, 0x61,
+	0x71, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x61, 0x00, 0x00, 0x09, 0x1c, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x1b, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x1a, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xcc, 0x61, 0xfa, 0x61, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x61, 0xe6, 0x61, 0xe0, 0x61,
+	0xe0, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x3a, 0x62, 0x46, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x62, 0x46, 0x62, 0x3d, 0x62, 0x46, 0x62,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x05, 0x05,
+	0x32, 0x05, 0x05, 0x07, 0x3d, 0x62, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x7e, 0x62, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x91, 0x62, 0x83, 0x62, 0x97, 0x62, 0xba, 0x79, 0x89, 0x62, 0x83, 0x62, 0x00, 0x00, 0x09, 0x23,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0x22, 0x01, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x21, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xdc, 0x62, 0x0a, 0x63, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x63, 0xf6, 0x62, 0xf0, 0x62,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x4a, 0x63, 0x56, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x63, 0x56, 0x63, 0x4d, 0x63, 0x56, 0x63,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x05, 0x05,
+	0x32, 0x05, 0x05, 0x07, 0x4d, 0x63, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00,
+	0x00, 0x00, 0x96, 0x63, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xd9, 0x63, 0x00, 0x00,
+	0xa7, 0x63, 0xa1, 0x63, 0xdf, 0x63, 0xb8, 0x63, 0xad, 0x63, 0xa1, 0x63, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xb5, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x1e, 0x01,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x2e, 0x18, 0xd7, 0x01, 0x00, 0x06, 0x00, 0x05,
+	0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x05, 0x05,
+	0x00, 0x05, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x05, 0x00, 0x07, 0xba, 0x79, 0x2e,
+	0x05, 0x0f, 0x18, 0xd8, 0x01, 0x00, 0x05, 0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00,
+	0x03, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x06, 0x00, 0x05, 0x05, 0x00, 0x00,
+	0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00,
+	0x44, 0x64, 0x56, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x64, 0x56, 0x64, 0x56, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x56, 0x64, 0x56, 0x64, 0x44, 0x64, 0x56, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x56, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05, 0x00, 0x02,
+	0x00, 0x05, 0x05, 0x07, 0x44, 0x64, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00,
+	0x00, 0x00, 0x96, 0x64, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xa7, 0x64, 0xa1, 0x64, 0xad, 0x64, 0xba, 0x79, 0xb8, 0x64, 0xa1, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xb5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x01, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x08, 0x26, 0x01,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x07, 0xb8, 0x64, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x65, 0x30, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x65, 0x21, 0x65, 0x1b, 0x65,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x68, 0x65, 0x23, 0x79,
+	0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 0x79, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x7e, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x2a, 0x01, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x29, 0x01, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x65, 0xc9, 0x65,
+	0xcc, 0x65, 0xcc, 0x65, 0x00, 0x00, 0xcc, 0x65, 0xcc, 0x65, 0x00, 0x00, 0xd5, 0x65, 0xd5, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xc3, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0xc3, 0x65, 0xc3, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x21, 0x07, 0xc3, 0x65, 0x05, 0x01, 0x16, 0x05, 0x01, 0x26, 0x2a,
+	0x24, 0x01, 0x05, 0x0d, 0x30, 0x07, 0xc3, 0x65, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00,
+	0x14, 0x66, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x66,
+	0x19, 0x66, 0x2d, 0x66, 0xba, 0x79, 0x1f, 0x66, 0x19, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x35, 0x66, 0x00, 0x00, 0x09, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x08,
+	0x3a, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x08, 0x39, 0x01,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00,
+	0x74, 0x66, 0xa2, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa2, 0x66, 0x8e, 0x66, 0x88, 0x66, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02,
+	0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00,
+	0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xe2, 0x66,
+	0xee, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xee, 0x66, 0xee, 0x66, 0xe5, 0x66, 0xee, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x05, 0x05, 0x32, 0x05, 0x05, 0x07, 0xe5, 0x66, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x26, 0x67, 0x61, 0x67, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2c, 0x67, 0xba, 0x79, 0x50, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x67, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x3c, 0x80, 0x00, 0x20,
+	0x00, 0x3d, 0x67, 0x0f, 0x35, 0x01, 0x00, 0x0a, 0x05, 0x03, 0x07, 0x33, 0x67, 0x05, 0x03, 0x0f,
+	0x35, 0x01, 0x00, 0xf6, 0x07, 0x3d, 0x67, 0x05, 0x7d, 0x05, 0x7d, 0x24, 0x02, 0x07, 0xba, 0x79,
+	0x27, 0x24, 0x01, 0x32, 0x08, 0xac, 0x01, 0x00, 0x00, 0x0f, 0x0b, 0x01, 0x00, 0xd6, 0x07, 0xba,
+	0x79, 0x08, 0xac, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00,
+	0x00, 0x00, 0x9e, 0x67, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc5, 0x67, 0xa3, 0x67, 0xcb, 0x67, 0xa3, 0x67, 0xa9, 0x67, 0xa3, 0x67, 0x00, 0x00, 0x09, 0x2f,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x03, 0x00, 0x02,
+	0x00, 0x05, 0x03, 0x00, 0x03, 0x00, 0x05, 0x03, 0x00, 0x04, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00,
+	0x05, 0x03, 0x07, 0xa9, 0x67, 0x00, 0x06, 0x00, 0x07, 0xba, 0x79, 0x08, 0x2e, 0x01, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x10, 0x68, 0x3e, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x68,
+	0x2a, 0x68, 0x24, 0x68, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x7e, 0x68, 0x23, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x68, 0x83, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x09, 0x31,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x32, 0x05, 0x01, 0x33, 0x05, 0x01, 0x32, 0x05, 0x01, 0x33, 0x05, 0x01, 0x32, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xe6, 0x68, 0x37, 0x69, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x69, 0x2b, 0x69, 0x31, 0x69, 0x16, 0x69, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x16, 0x69, 0x00, 0x00, 0x09, 0x34, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x05,
+	0x06, 0x05, 0x32, 0x38, 0x00, 0x06, 0x05, 0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x38, 0x01, 0x06,
+	0x05, 0x32, 0x38, 0x02, 0x06, 0x05, 0x32, 0x38, 0x00, 0x06, 0x05, 0x32, 0x38, 0x01, 0x06, 0x05,
+	0x32, 0x38, 0x02, 0x07, 0xee, 0x68, 0x00, 0x00, 0x00, 0x05, 0x05, 0x38, 0x00, 0x05, 0x14, 0x06,
+	0x05, 0x64, 0x07, 0x1b, 0x69, 0x00, 0x02, 0x00, 0x07, 0xee, 0x68, 0x00, 0x03, 0x00, 0x07, 0xee,
+	0x68, 0x00, 0x04, 0x00, 0x07, 0xee, 0x68, 0x18, 0x07, 0x00, 0x0f, 0x10, 0x01, 0x00, 0x00, 0x05,
+	0x03, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x76, 0x69, 0x23, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0xba, 0x79, 0xa5, 0x69, 0x00, 0x00, 0xc9, 0x69, 0x7b, 0x69, 0xab, 0x69, 0x89, 0x69,
+	0x81, 0x69, 0x7b, 0x69, 0x00, 0x00, 0x09, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x36, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x18, 0xd7, 0x01, 0x00, 0x02, 0x00,
+	0x05, 0x05, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x05, 0x00, 0x24,
+	0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x05, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x05, 0x12, 0x18, 0xd8,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05,
+	0x00, 0x00, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x6a, 0x18, 0x6a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6a,
+	0x18, 0x6a, 0x18, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6a, 0x18, 0x6a, 0x0f, 0x6a,
+	0x18, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+	0x05, 0x05, 0x32, 0x05, 0x05, 0x07, 0x0f, 0x6a, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x14, 0x00, 0x00, 0x00, 0x50, 0x6a, 0x38, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x85, 0x6a,
+	0x00, 0x00, 0x5b, 0x6a, 0x55, 0x6a, 0x8b, 0x6a, 0x69, 0x6a, 0x61, 0x6a, 0x55, 0x6a, 0x00, 0x00,
+	0x09, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x05, 0x00, 0x07, 0xba,
+	0x79, 0x08, 0x40, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x18, 0xd7, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00, 0x24,
+	0x10, 0x2f, 0x07, 0xba, 0x79, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x05, 0x14, 0x18, 0xd8,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05,
+	0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x53, 0x43,
+	0x50, 0x45, 0x18, 0x00, 0x00, 0x00, 0xea, 0x6a, 0xfc, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x6a, 0xea, 0x6a,
+	0xfc, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x6a, 0xea, 0x6a, 0xea, 0x6a, 0xfc, 0x6a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x07, 0xea, 0x6a, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x6b, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x07, 0x0c, 0x6b, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x30, 0x6b, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x08, 0x65, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x18, 0x00, 0x00, 0x00, 0x78, 0x6b, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xb0, 0x6b,
+	0x00, 0x00, 0x8e, 0x6b, 0x83, 0x6b, 0xb6, 0x6b, 0x94, 0x6b, 0xba, 0x79, 0x88, 0x6b, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd9, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x01, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x08, 0x43, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01,
+	0x00, 0x07, 0xba, 0x79, 0x2e, 0x18, 0xd7, 0x01, 0x00, 0x05, 0x00, 0x05, 0x04, 0x00, 0x03, 0x00,
+	0x05, 0x04, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x04, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79,
+	0x00, 0x04, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x05, 0x19, 0x18, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x04, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x03, 0x00, 0x05, 0x04, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x00, 0x00, 0x00, 0x24, 0x10, 0x2f, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x3f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x3f, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xba, 0x79, 0x1e, 0x6c, 0x18, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x05, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x05, 0x00, 0x05, 0x05, 0x07, 0x1e, 0x6c, 0x05,
+	0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x71, 0x6c, 0x7c, 0x6c,
+	0x84, 0x6c, 0x00, 0x00, 0x7c, 0x6c, 0x84, 0x6c, 0x94, 0x6c, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00,
+	0x8c, 0x6c, 0xa2, 0x79, 0x00, 0x00, 0x09, 0xdb, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x18, 0xb1, 0x00, 0x08, 0x4d, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x08, 0xbe, 0x01, 0x00,
+	0x00, 0x07, 0xc0, 0x79, 0x08, 0xbe, 0x01, 0x00, 0x00, 0x07, 0xc8, 0x79, 0x08, 0xdc, 0x00, 0x00,
+	0x00, 0x07, 0xba, 0x79, 0x0a, 0x1f, 0x02, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0xbe, 0x6c, 0xc9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x6c, 0xa2, 0x79, 0x00, 0x00, 0x09, 0xe0,
+	0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x18, 0xd2, 0x00, 0x08, 0x4c, 0x01, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x08, 0xe1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x77, 0x6d, 0xbf, 0x6d, 0x00, 0x00, 0x00, 0x00,
+	0xc2, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x84, 0x6d, 0x07, 0x6d,
+	0x00, 0x00, 0x09, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x19, 0x2e,
+	0x6d, 0x1e, 0x80, 0x18, 0x6d, 0x07, 0x0a, 0x6d, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00,
+	0x05, 0x01, 0x22, 0x03, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x07, 0x07, 0x6d, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x1e, 0xc0, 0x72, 0x6d, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f,
+	0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x05, 0x06, 0x20, 0x02, 0x05,
+	0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05,
+	0x03, 0x05, 0x06, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x07,
+	0x07, 0x6d, 0x05, 0x0d, 0x07, 0x07, 0x6d, 0x1a, 0x28, 0x01, 0x2a, 0x01, 0x08, 0x4c, 0x01, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x07, 0x84, 0x6d, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x2e, 0x08, 0xa5, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x31, 0x18, 0x05,
+	0x01, 0x31, 0x34, 0x05, 0x01, 0x31, 0x50, 0x05, 0x05, 0x00, 0x00, 0x00, 0x05, 0x02, 0x30, 0x07,
+	0x07, 0x6d, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x12, 0x6e, 0x99, 0x6e, 0x22, 0x6f,
+	0x22, 0x6f, 0x00, 0x00, 0x2f, 0x6f, 0x2f, 0x6f, 0x5b, 0x6f, 0x41, 0x6f, 0x41, 0x6f, 0x00, 0x00,
+	0xce, 0x6e, 0x17, 0x6e, 0x10, 0x6f, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x6e,
+	0x20, 0x79, 0x09, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x19, 0x3e,
+	0x6e, 0x1e, 0x80, 0x28, 0x6e, 0x07, 0x1a, 0x6e, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00,
+	0x05, 0x01, 0x22, 0x03, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x07, 0x17, 0x6e, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x1e, 0xc0, 0x8a, 0x6e, 0x1f,
+	0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f,
+	0x02, 0x05, 0x03, 0x05, 0x06, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05,
+	0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x05, 0x06, 0x1f, 0x02, 0x05, 0x03, 0x1f,
+	0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x07, 0x8c, 0x6e, 0x05, 0x0d, 0x00, 0x11, 0x00, 0x05,
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x17, 0x6e, 0x18, 0xee, 0x00, 0x34, 0x00, 0x00, 0xdd,
+	0x00, 0x05, 0x02, 0x00, 0xde, 0x00, 0x05, 0x02, 0x00, 0xdf, 0x00, 0x05, 0x02, 0x00, 0xe0, 0x00,
+	0x05, 0x02, 0x00, 0xe1, 0x00, 0x05, 0x02, 0x00, 0xe2, 0x00, 0x05, 0x02, 0x00, 0xe3, 0x00, 0x05,
+	0x02, 0x00, 0xe4, 0x00, 0x05, 0x02, 0x11, 0xe6, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x07, 0xce, 0x6e,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x07,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05,
+	0x01, 0x2e, 0x18, 0x62, 0x00, 0x26, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x2f, 0x2a,
+	0x30, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x17, 0x6e, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x2e, 0x05, 0x01, 0x18, 0xf0,
+	0x00, 0x27, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x2f, 0x2a, 0x24, 0x02, 0x07, 0x41,
+	0x6f, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x6f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x17, 0x00, 0x00, 0x00, 0xcb, 0x6f, 0xd6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x6f, 0xd0, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc6, 0x6f, 0x08, 0xeb, 0x00, 0x00, 0x00, 0x09, 0xec, 0x00, 0x00, 0x00,
+	0x00, 0x77, 0x00, 0x07, 0xba, 0x79, 0x18, 0x08, 0x00, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03,
+	0x16, 0x29, 0x06, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x03, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29,
+	0x03, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x03, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x05, 0x05,
+	0x01, 0x00, 0x22, 0x00, 0x29, 0x05, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x29, 0x08, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x06, 0x05, 0x01, 0x00, 0x66, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x07, 0xe1, 0x6f, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x4e, 0x70, 0x20, 0x79, 0x9d, 0x70, 0xbf, 0x70, 0x00, 0x00, 0x9d, 0x70, 0xbf, 0x70,
+	0x00, 0x00, 0x4e, 0x70, 0x4e, 0x70, 0x00, 0x00, 0x54, 0x70, 0x4e, 0x70, 0x00, 0x00, 0x00, 0x77,
+	0x00, 0x07, 0xba, 0x79, 0x29, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00,
+	0x99, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x29, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x00,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x00, 0x05, 0x01,
+	0x00, 0x66, 0x00, 0x29, 0x00, 0x05, 0x01, 0x00, 0x77, 0x00, 0x07, 0x54, 0x70, 0x00, 0xaa, 0x00,
+	0x18, 0x46, 0x00, 0x25, 0x01, 0x05, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x05,
+	0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x2a, 0x07, 0x4e, 0x70, 0x05,
+	0x01, 0x25, 0x02, 0x2a, 0x07, 0x4e, 0x70, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0xf8, 0x70, 0x7f, 0x71, 0xf8, 0x71, 0xf8, 0x71, 0x00, 0x00, 0x05, 0x72, 0x05, 0x72, 0x00, 0x00,
+	0x2e, 0x72, 0x2e, 0x72, 0x00, 0x00, 0xb6, 0x71, 0xfd, 0x70, 0x00, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x84, 0x71, 0x20, 0x79, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+	0x06, 0x3f, 0x4b, 0x1e, 0x19, 0x24, 0x71, 0x1e, 0x80, 0x0e, 0x71, 0x07, 0x00, 0x71, 0x00, 0x55,
+	0x00, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x22, 0x03, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05,
+	0x01, 0x07, 0xfd, 0x70, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22,
+	0x00, 0x1e, 0xc0, 0x70, 0x71, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05,
+	0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x05, 0x06, 0x20, 0x02, 0x05, 0x03, 0x20,
+	0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x05,
+	0x06, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x07, 0x72, 0x71,
+	0x05, 0x0d, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0xfd, 0x70, 0x1a,
+	0x14, 0x01, 0x15, 0x01, 0x34, 0x00, 0x00, 0xdd, 0x00, 0x05, 0x02, 0x00, 0xde, 0x00, 0x05, 0x02,
+	0x00, 0xdf, 0x00, 0x05, 0x02, 0x00, 0xe0, 0x00, 0x05, 0x02, 0x00, 0xe1, 0x00, 0x05, 0x02, 0x00,
+	0xe2, 0x00, 0x05, 0x02, 0x00, 0xe3, 0x00, 0x05, 0x02, 0x00, 0xe4, 0x00, 0x05, 0x02, 0x11, 0xec,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xaa, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xcc, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x44, 0x00, 0x07, 0xb6, 0x71, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+	0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x2e, 0x18, 0x45, 0x00, 0x25, 0x01, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05,
+	0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x30, 0x00, 0x11,
+	0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0xfd, 0x70, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x72, 0x8e, 0x72, 0x0f, 0x7c, 0x01, 0x00, 0x00, 0x05, 0x06, 0x0f,
+	0x7c, 0x01, 0x20, 0x20, 0x05, 0x02, 0x0f, 0x7c, 0x01, 0x30, 0x05, 0x05, 0x05, 0x0f, 0x7c, 0x01,
+	0x20, 0xe0, 0x05, 0x02, 0x0f, 0x7c, 0x01, 0xfb, 0xd0, 0x05, 0x02, 0x0f, 0x7c, 0x01, 0xe0, 0xe0,
+	0x05, 0x05, 0x0f, 0x7c, 0x01, 0xd0, 0xfe, 0x05, 0x03, 0x0f, 0x7c, 0x01, 0xe0, 0x20, 0x05, 0x05,
+	0x0f, 0x7c, 0x01, 0x03, 0x30, 0x05, 0x3f, 0x05, 0x3f, 0x24, 0x04, 0x07, 0xba, 0x79, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x16, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0xd2, 0x72, 0xdd, 0x72, 0xc0, 0x79, 0xc8, 0x79, 0x00, 0x00,
+	0xc0, 0x79, 0xc8, 0x79, 0x00, 0x00, 0xa2, 0x79, 0xa2, 0x79, 0x00, 0x00, 0xe8, 0x72, 0xa2, 0x79,
+	0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x79, 0x18, 0x01, 0x01,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x08, 0xf5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07,
+	0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x0f, 0x00, 0x00, 0x00, 0x1a, 0x73, 0x25, 0x73, 0x51, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x51, 0x73, 0x00, 0x00, 0x00, 0x00, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x73, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x73, 0x09, 0xf8, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x71, 0x01, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16,
+	0x00, 0x00, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba, 0x79, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x22, 0x00, 0x28, 0x0e, 0x05, 0x01, 0x00, 0x11, 0x00, 0x06, 0x08, 0x0a, 0x07, 0x41,
+	0x73, 0x03, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x25, 0x01, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05,
+	0x01, 0x2a, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x17, 0x00, 0x00, 0x00, 0xa9, 0x73, 0xd9, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe4, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa4, 0x73, 0x0d, 0xfe, 0x00, 0x02, 0x00, 0x09, 0xff, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x37, 0x00, 0x00, 0x18, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05,
+	0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00,
+	0x05, 0x00, 0x05, 0x26, 0x24, 0x01, 0x07, 0xba, 0x79, 0x18, 0x3d, 0x01, 0x08, 0x4d, 0x01, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x05, 0x26, 0x18, 0x3f, 0x01, 0x00, 0x04, 0x00, 0x05, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x05, 0x00, 0x02, 0x00, 0x05, 0x05, 0x00, 0x01, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00,
+	0x05, 0x05, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00,
+	0x30, 0x74, 0x20, 0x79, 0x5a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x74, 0x74, 0x00, 0x00,
+	0x00, 0x11, 0x00, 0x05, 0x01, 0x2e, 0x05, 0x26, 0x18, 0x3e, 0x01, 0x05, 0x03, 0x00, 0x22, 0x00,
+	0x05, 0x03, 0x00, 0x33, 0x00, 0x05, 0x03, 0x00, 0x44, 0x00, 0x05, 0x03, 0x00, 0x55, 0x00, 0x05,
+	0x03, 0x34, 0x1c, 0x00, 0x00, 0x00, 0x2f, 0x07, 0xba, 0x79, 0x05, 0x01, 0x2e, 0x18, 0x60, 0x00,
+	0x0d, 0x19, 0x02, 0x02, 0x00, 0x05, 0x02, 0x25, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x2a,
+	0x30, 0x07, 0xba, 0x79, 0x34, 0x0c, 0x18, 0x3e, 0x01, 0x00, 0x55, 0x00, 0x05, 0x03, 0x00, 0x44,
+	0x00, 0x05, 0x03, 0x00, 0x33, 0x00, 0x05, 0x03, 0x00, 0x22, 0x00, 0x05, 0x03, 0x00, 0x11, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x17, 0x00, 0x00, 0x00, 0xd3, 0x74, 0xe2, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xed, 0x74, 0xdc, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x74, 0x34, 0x0c, 0x0d, 0xfb,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x09, 0xfc, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x18, 0x3d, 0x01, 0x08, 0x4d, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0x00, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0x22, 0x00, 0x07, 0xed, 0x74, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x2a, 0x75,
+	0x20, 0x79, 0x31, 0x75, 0x00, 0x00, 0x00, 0x00, 0x31, 0x75, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0xba, 0x79, 0x05, 0x01, 0x34, 0x0c, 0x07, 0xba,
+	0x79, 0x05, 0x01, 0x2e, 0x18, 0x44, 0x00, 0x08, 0x18, 0x02, 0x00, 0x00, 0x05, 0x02, 0x25, 0x01,
+	0x2f, 0x2a, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x6a, 0x75,
+	0xf1, 0x75, 0x50, 0x76, 0x50, 0x76, 0x00, 0x00, 0x5d, 0x76, 0x5d, 0x76, 0x89, 0x76, 0x6f, 0x76,
+	0x6f, 0x76, 0x00, 0x00, 0xfc, 0x75, 0x6f, 0x75, 0x3e, 0x76, 0x09, 0xee, 0x00, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x19, 0x96, 0x75, 0x1e, 0x80, 0x80, 0x75, 0x07, 0x72, 0x75,
+	0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x22, 0x03, 0x05, 0x01, 0x00, 0x44,
+	0x00, 0x05, 0x01, 0x07, 0x6f, 0x75, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01,
+	0x00, 0x22, 0x00, 0x1e, 0xc0, 0xe2, 0x75, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f,
+	0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x05, 0x06, 0x20, 0x02, 0x05,
+	0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05, 0x03, 0x20, 0x02, 0x05,
+	0x03, 0x05, 0x06, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x1f, 0x02, 0x05, 0x03, 0x07,
+	0xe4, 0x75, 0x05, 0x0d, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x6f,
+	0x75, 0x18, 0xd6, 0x01, 0x08, 0xe7, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x07, 0xfc, 0x75, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x07, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x2e,
+	0x18, 0x62, 0x00, 0x26, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x2f, 0x2a, 0x30, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x6f, 0x75, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x2e, 0x05, 0x01, 0x18, 0xf0, 0x00, 0x27,
+	0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x2f, 0x2a, 0x24, 0x02, 0x07, 0x6f, 0x76, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xc4, 0x76, 0xcf, 0x76, 0xc0, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0xda, 0x76, 0x09, 0x01, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18,
+	0x61, 0x01, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x25, 0x01, 0x24, 0x01, 0x05, 0x01,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1a, 0x00, 0x00, 0x00, 0x22, 0x77, 0xb5, 0x77, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x71, 0x77, 0x27, 0x77, 0xaf, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x77, 0x50, 0x77,
+	0x00, 0x00, 0x09, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x2e, 0x08, 0xa7,
+	0x01, 0x00, 0x00, 0x18, 0x62, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01,
+	0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x24, 0x04, 0x2f, 0x07, 0xba, 0x79,
+	0x2e, 0x09, 0xa7, 0x01, 0x00, 0x00, 0x18, 0x62, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x09,
+	0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x24, 0x04, 0x2f, 0x07, 0x27,
+	0x77, 0x18, 0x63, 0x01, 0x29, 0x10, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x10, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x29, 0x10, 0x05, 0x01, 0x00, 0x02, 0x00, 0x29, 0x10, 0x05, 0x01, 0x00, 0x03, 0x00,
+	0x29, 0x10, 0x05, 0x01, 0x00, 0x04, 0x00, 0x29, 0x10, 0x05, 0x01, 0x00, 0x05, 0x00, 0x29, 0x10,
+	0x05, 0x01, 0x00, 0x06, 0x00, 0x29, 0x10, 0x05, 0x01, 0x00, 0x07, 0x00, 0x07, 0x71, 0x77, 0x27,
+	0x24, 0x01, 0x07, 0xba, 0x79, 0x08, 0xad, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0xe2, 0x77, 0x02, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79,
+	0x00, 0x00, 0x08, 0x05, 0x01, 0x00, 0x00, 0x09, 0x06, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07,
+	0xba, 0x79, 0x08, 0x1b, 0x02, 0x00, 0x00, 0x2e, 0x05, 0x03, 0x27, 0x2f, 0x2a, 0x24, 0x02, 0x07,
+	0xba, 0x79, 0x18, 0x5c, 0x01, 0x08, 0x4d, 0x01, 0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x32, 0x78, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00,
+	0x60, 0x78, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x78, 0x71, 0x78, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x46, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x02, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00,
+	0xa0, 0x78, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x78, 0xb1, 0x78, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x48, 0x01, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x02, 0x00, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00,
+	0x08, 0x79, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x79, 0x19, 0x79, 0x00, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x79, 0x23, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x01, 0x00, 0x00,
+	0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x00, 0x02, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x05, 0x01, 0x16, 0x18, 0x07, 0x00, 0x08, 0x4e, 0x01, 0x00, 0x00, 0x05, 0x03, 0x3f, 0x20, 0x79,
+	0x11, 0x11, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x18, 0x07, 0x00, 0x08, 0x4e, 0x01, 0x00, 0x00,
+	0x05, 0x03, 0x3f, 0x20, 0x79, 0x11, 0x12, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x18, 0x06, 0x03,
+	0x08, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x03, 0x11, 0xba, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x18,
+	0x06, 0x03, 0x08, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x03, 0x11, 0xbb, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x16, 0x18, 0x07, 0x00, 0x08, 0xd7, 0x00, 0x00, 0x00, 0x05, 0x03, 0x11, 0xdf, 0x00, 0x00, 0x00,
+	0x05, 0x01, 0x16, 0x18, 0x07, 0x00, 0x08, 0xd7, 0x00, 0x00, 0x00, 0x05, 0x03, 0x11, 0xe0, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0xba, 0x79, 0x03, 0x01, 0x06, 0x08, 0x0a, 0x03, 0x02, 0x06, 0x08, 0x0a, 0x03, 0x01, 0x06, 0x08,
+	0x0a, 0x03, 0x00, 0x06, 0x08, 0x0a, 0x07, 0xa2, 0x79, 0x00, 0x05, 0x7d, 0x07, 0xba, 0x79, 0x00,
+	0x05, 0x01, 0x25, 0x01, 0x2a, 0x07, 0xba, 0x79, 0x05, 0x01, 0x25, 0x02, 0x2a, 0x07, 0xba, 0x79,
+	0x05, 0x01, 0x25, 0x03, 0x2a, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00,
+	0xe4, 0x79, 0xea, 0x79, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x79, 0x02, 0x7a, 0x00, 0x00, 0x00, 0x17, 0x01, 0x07,
+	0xba, 0x79, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x12, 0x7a,
+	0x20, 0x79, 0x05, 0x01, 0x1d, 0x07, 0x12, 0x7a, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00,
+	0x00, 0x00, 0x36, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03,
+	0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x07, 0x4f, 0x7a,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03,
+	0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00,
+	0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x07, 0x7f, 0x7a, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00,
+	0x00, 0x00, 0xea, 0x7a, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf6, 0x7a, 0x2b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x7a, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x00, 0x09, 0x00, 0x07, 0xba, 0x79, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02,
+	0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07,
+	0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xa0, 0x7b, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x7b, 0xe7, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x7b,
+	0x00, 0x00, 0x00, 0x17, 0x01, 0x07, 0xba, 0x79, 0x00, 0x09, 0x00, 0x17, 0x01, 0x07, 0xba, 0x79,
+	0x00, 0x09, 0x00, 0x17, 0x01, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05,
+	0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02,
+	0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x09, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0xca, 0x7c, 0x20, 0x7d, 0xd0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7c, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x7c, 0xd9, 0x7c, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x7c,
+	0xd9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00,
+	0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05,
+	0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02,
+	0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08,
+	0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00,
+	0x08, 0xe1, 0x02, 0x00, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79,
+	0x05, 0x01, 0x25, 0x01, 0x2a, 0x30, 0x07, 0xba, 0x79, 0x23, 0x14, 0x05, 0x01, 0x3c, 0xa0, 0x00,
+	0x0a, 0x00, 0xe9, 0x7c, 0x05, 0x02, 0x07, 0xdd, 0x7c, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x02,
+	0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00,
+	0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00, 0x00, 0x00,
+	0x64, 0x7d, 0x20, 0x79, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x7d, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6e, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x34, 0x14, 0x07, 0xba, 0x79, 0x05, 0x01,
+	0x3c, 0xa0, 0x00, 0x0a, 0x00, 0x7c, 0x7d, 0x05, 0x02, 0x07, 0x70, 0x7d, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xf5, 0x7d, 0x57, 0x7e, 0xfb, 0x7d, 0x00, 0x00,
+	0x00, 0x00, 0xfb, 0x7d, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0x7d, 0x27, 0x7e, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x7d, 0x27, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07,
+	0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x24, 0x01, 0x00,
+	0x0a, 0x00, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x2e, 0x18, 0x46,
+	0x00, 0x25, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00,
+	0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05,
+	0x01, 0x2f, 0x2a, 0x30, 0x07, 0xba, 0x79, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05,
+	0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xc1, 0x7e, 0xf0, 0x7e, 0xcb, 0x7e, 0x00, 0x00,
+	0x00, 0x00, 0xcb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa0, 0x7e, 0xd4, 0x7e, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x7e, 0xd4, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x24, 0x01, 0x07, 0xba,
+	0x79, 0x00, 0x01, 0x00, 0x05, 0x01, 0x34, 0x0c, 0x07, 0xba, 0x79, 0x05, 0x01, 0x25, 0x01, 0x2a,
+	0x30, 0x07, 0xba, 0x79, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79,
+	0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0x5b, 0x7f, 0x8c, 0x7f, 0x67, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x67, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7f, 0x70, 0x7f, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7f,
+	0x70, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x01, 0x00, 0x17, 0x01, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05,
+	0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x17, 0x01,
+	0x05, 0x01, 0x34, 0x14, 0x07, 0xba, 0x79, 0x05, 0x01, 0x25, 0x01, 0x2a, 0x30, 0x07, 0xba, 0x79,
+	0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00,
+	0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x09, 0x80, 0x5f, 0x80,
+	0x13, 0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0x80, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x7f, 0x2d, 0x80, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x7f, 0x2d, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00,
+	0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00, 0x05,
+	0x02, 0x00, 0x0a, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00, 0x01, 0x00, 0x05, 0x01, 0x34, 0x0c,
+	0x07, 0xba, 0x79, 0x05, 0x01, 0x2e, 0x0d, 0xa5, 0x01, 0x00, 0x00, 0x34, 0x0c, 0x31, 0x18, 0x05,
+	0x02, 0x31, 0x34, 0x05, 0x01, 0x31, 0x50, 0x05, 0x0a, 0x30, 0x07, 0xba, 0x79, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05,
+	0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x24, 0x01, 0x07, 0xba, 0x79, 0x08,
+	0x4c, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x1b, 0x00, 0x00, 0x00,
+	0xdf, 0x80, 0x37, 0x81, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x80, 0x05, 0x81, 0xba, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x80,
+	0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0xba, 0x79, 0x00, 0x01, 0x00, 0x17, 0x01, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05,
+	0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00,
+	0x05, 0x02, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x24, 0x01, 0x07, 0xba, 0x79, 0x00,
+	0x01, 0x00, 0x17, 0x01, 0x05, 0x01, 0x34, 0x14, 0x07, 0xba, 0x79, 0x05, 0x01, 0x2e, 0x0d, 0xa5,
+	0x01, 0x00, 0x00, 0x34, 0x14, 0x31, 0x18, 0x05, 0x02, 0x31, 0x34, 0x05, 0x01, 0x31, 0x50, 0x05,
+	0x0a, 0x30, 0x07, 0xba, 0x79, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00,
+	0x05, 0x02, 0x24, 0x01, 0x07, 0xba, 0x79, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02,
+	0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00,
+	0x07, 0x00, 0x05, 0x02, 0x07, 0x4c, 0x81, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x84, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x07, 0x8b, 0x81, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x81,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02,
+	0x07, 0xc2, 0x81, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x81, 0x23, 0x82,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00,
+	0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x05, 0x03, 0x00, 0x06, 0x00, 0x05,
+	0x03, 0x00, 0x07, 0x00, 0x05, 0x03, 0x00, 0x08, 0x00, 0x05, 0x03, 0x00, 0x09, 0x00, 0x05, 0x03,
+	0x07, 0x07, 0x82, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x82, 0x9a, 0x82, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x00,
+	0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00,
+	0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05,
+	0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02,
+	0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xce, 0x82, 0x20, 0x79, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00,
+	0x00, 0x00, 0xeb, 0x82, 0x20, 0x79, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x08, 0x83,
+	0x20, 0x79, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x25, 0x83, 0x20, 0x79, 0x32, 0x06,
+	0x01, 0x03, 0x33, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00,
+	0x05, 0x02, 0x00, 0x33, 0x00, 0x06, 0x02, 0x03, 0x07, 0xd3, 0x82, 0x32, 0x06, 0x01, 0x03, 0x33,
+	0x00, 0x44, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00,
+	0x77, 0x00, 0x06, 0x02, 0x03, 0x07, 0xf0, 0x82, 0x32, 0x06, 0x01, 0x03, 0x33, 0x00, 0x88, 0x00,
+	0x05, 0x02, 0x00, 0x99, 0x00, 0x05, 0x02, 0x00, 0xaa, 0x00, 0x05, 0x02, 0x00, 0xbb, 0x00, 0x06,
+	0x02, 0x03, 0x07, 0x0d, 0x83, 0x32, 0x06, 0x01, 0x03, 0x33, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00,
+	0xdd, 0x00, 0x05, 0x02, 0x00, 0xee, 0x00, 0x05, 0x02, 0x00, 0xff, 0x00, 0x06, 0x02, 0x03, 0x07,
+	0x2a, 0x83, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x66, 0x83, 0x20, 0x79, 0x20, 0x79,
+	0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x79, 0x20, 0x79, 0x20, 0x79, 0x00, 0x00,
+	0x66, 0x83, 0x20, 0x79, 0x00, 0x00, 0x2b, 0x00, 0x05, 0x01, 0x2b, 0x11, 0x05, 0x01, 0x07, 0x66,
+	0x83, 0x00, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x82, 0x83, 0x88, 0x83, 0x88, 0x83,
+	0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x18, 0x5f, 0x00, 0x1b, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x83, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01,
+	0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00,
+	0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a,
+	0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00,
+	0x05, 0x01, 0x00, 0x0e, 0x00, 0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00, 0x05,
+	0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x07, 0x20, 0x79, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x84, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05,
+	0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01,
+	0x00, 0x0e, 0x00, 0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00, 0x05, 0x01, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x00, 0x12, 0x00, 0x05, 0x01, 0x00, 0x13, 0x00, 0x05, 0x01, 0x00, 0x14,
+	0x00, 0x07, 0x20, 0x79, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x84, 0x20, 0x79,
+	0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00,
+	0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05,
+	0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02,
+	0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00,
+	0x13, 0x00, 0x05, 0x02, 0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15, 0x00, 0x05, 0x02, 0x00, 0x16,
+	0x00, 0x05, 0x02, 0x00, 0x17, 0x00, 0x05, 0x02, 0x07, 0xa0, 0x84, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x85, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01,
+	0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00,
+	0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01, 0x00, 0x0e,
+	0x00, 0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01,
+	0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00,
+	0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01, 0x00, 0x0e,
+	0x00, 0x05, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x01, 0x07, 0x20, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x01, 0x00, 0x00, 0x00, 0xd8, 0x85, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01,
+	0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x07, 0x20, 0x79, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x86, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x07, 0x20, 0x79, 0x53, 0x43, 0x50, 0x45, 0x02, 0x00,
+	0x00, 0x00, 0x5a, 0x86, 0x81, 0x86, 0x6a, 0x86, 0x00, 0x00, 0x32, 0x3a, 0x28, 0x00, 0x61, 0x86,
+	0x33, 0x00, 0x00, 0x00, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x07, 0xba,
+	0x79, 0x18, 0x48, 0x00, 0x08, 0xc3, 0x03, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x86, 0xcf, 0x86, 0x00, 0x00, 0x00, 0x18, 0x47, 0x04,
+	0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05,
+	0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xf4, 0x86, 0x3a, 0x87, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x87, 0x00, 0x07, 0x00, 0x05, 0x01, 0x06, 0x0a, 0x0f, 0x00, 0x08, 0x00, 0x05,
+	0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x07, 0xfc, 0x86, 0x05, 0x01,
+	0x2e, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00,
+	0x06, 0x00, 0x05, 0x02, 0x24, 0x04, 0x2f, 0x07, 0xba, 0x79, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x87, 0x20, 0x79, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00,
+	0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00,
+	0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00,
+	0x9c, 0x87, 0xa7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x87, 0xa1, 0x87, 0x00, 0x00, 0x09, 0xb9, 0x03, 0x00,
+	0x00, 0x00, 0x66, 0x00, 0x07, 0xba, 0x79, 0x18, 0xcf, 0x03, 0x34, 0x00, 0x00, 0xcc, 0x00, 0x05,
+	0x02, 0x00, 0xcd, 0x00, 0x05, 0x02, 0x00, 0xce, 0x00, 0x05, 0x02, 0x00, 0xcf, 0x00, 0x05, 0x02,
+	0x00, 0xd0, 0x00, 0x05, 0x02, 0x00, 0xd1, 0x00, 0x05, 0x02, 0x00, 0xd2, 0x00, 0x05, 0x02, 0x00,
+	0xd3, 0x00, 0x05, 0x02, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x11,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00,
+	0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xaa, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x07, 0xd5, 0x87, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x5e, 0x88, 0xa2, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x88, 0x63, 0x88, 0x00, 0x00, 0x09, 0xbb,
+	0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00,
+	0x05, 0x02, 0x00, 0x33, 0x00, 0x05, 0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x05,
+	0x02, 0x00, 0x66, 0x00, 0x05, 0x02, 0x00, 0x77, 0x00, 0x05, 0x02, 0x00, 0x88, 0x00, 0x05, 0x02,
+	0x00, 0x99, 0x00, 0x05, 0x02, 0x00, 0xaa, 0x00, 0x05, 0x02, 0x00, 0xbb, 0x00, 0x05, 0x02, 0x07,
+	0x63, 0x88, 0x18, 0xd3, 0x03, 0x34, 0x00, 0x00, 0xcc, 0x00, 0x05, 0x02, 0x00, 0xcd, 0x00, 0x05,
+	0x02, 0x00, 0xce, 0x00, 0x05, 0x02, 0x00, 0xcf, 0x00, 0x05, 0x02, 0x00, 0xd0, 0x00, 0x05, 0x02,
+	0x00, 0xd1, 0x00, 0x05, 0x02, 0x00, 0xd2, 0x00, 0x05, 0x02, 0x00, 0xd3, 0x00, 0x05, 0x02, 0x00,
+	0xd4, 0x00, 0x05, 0x02, 0x00, 0xd5, 0x00, 0x05, 0x02, 0x16, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44,
+	0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00, 0x77, 0x00,
+	0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x05,
+	0x01, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x07, 0xda, 0x88, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0x3e, 0x89, 0x49, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x89, 0x43, 0x89, 0x00, 0x00, 0x09, 0xbd,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0xcb, 0x03, 0x34, 0x00, 0x00, 0x88,
+	0x00, 0x05, 0x02, 0x00, 0x89, 0x00, 0x05, 0x02, 0x00, 0x8a, 0x00, 0x05, 0x02, 0x00, 0x8b, 0x00,
+	0x05, 0x02, 0x00, 0x8c, 0x00, 0x05, 0x32, 0x00, 0x8d, 0x00, 0x05, 0x32, 0x00, 0x8e, 0x00, 0x05,
+	0x32, 0x00, 0x8f, 0x00, 0x05, 0x32, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x33, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x55,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77, 0x00, 0x07,
+	0x77, 0x89, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xe6, 0x89, 0x23, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x89, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x09, 0xb4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba,
+	0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x26, 0x8a, 0x23, 0x79, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x8a, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x79, 0xba, 0x79, 0x00, 0x00, 0x09, 0xb6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x07, 0x2b,
+	0x8a, 0x00, 0x53, 0x43, 0x50, 0x45, 0x15, 0x00, 0x00, 0x00, 0x86, 0x8a, 0x99, 0x8a, 0xb1, 0x8a,
+	0xe6, 0x8a, 0x00, 0x00, 0xb1, 0x8a, 0xe6, 0x8a, 0x1e, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x00, 0x00,
+	0xa4, 0x8a, 0x8b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x91, 0x8a, 0x09, 0xa2, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2,
+	0x79, 0x08, 0x8f, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x18, 0x15, 0x02, 0x08, 0xd5, 0x00, 0x00,
+	0x00, 0x05, 0x03, 0x16, 0x08, 0xa3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xba,
+	0x79, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x01, 0x25, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33,
+	0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00,
+	0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05,
+	0x01, 0x2f, 0x2a, 0x07, 0x8b, 0x8a, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x01, 0x25, 0x02, 0x18, 0x24,
+	0x04, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01,
+	0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x2f, 0x2a, 0x07, 0x8b, 0x8a, 0x00, 0x00,
+	0x00, 0x2e, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x18, 0x23, 0x04, 0x27, 0x2f, 0x2a, 0x24,
+	0x02, 0x07, 0x8b, 0x8a, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xa5, 0x8b, 0x58, 0x8b,
+	0xe4, 0x8b, 0xe4, 0x8b, 0x00, 0x00, 0xe4, 0x8b, 0xe4, 0x8b, 0x2d, 0x8c, 0xe4, 0x8b, 0xe4, 0x8b,
+	0x00, 0x00, 0xe4, 0x8b, 0xe4, 0x8b, 0x63, 0x8b, 0x18, 0x07, 0x00, 0x08, 0xa0, 0x03, 0x00, 0x00,
+	0x05, 0x03, 0x16, 0x18, 0x69, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02,
+	0x00, 0x0c, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00,
+	0x0f, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x10,
+	0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x00,
+	0x05, 0x02, 0x07, 0x70, 0x8b, 0x00, 0x12, 0x00, 0x05, 0x01, 0x2e, 0x05, 0x01, 0x00, 0x13, 0x00,
+	0x05, 0x02, 0x00, 0x14, 0x00, 0x05, 0x02, 0x00, 0x15, 0x00, 0x05, 0x02, 0x00, 0x16, 0x00, 0x05,
+	0x02, 0x00, 0x17, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x05, 0x02, 0x00, 0x19, 0x00, 0x05, 0x02,
+	0x00, 0x1a, 0x00, 0x05, 0x02, 0x08, 0x9e, 0x03, 0x00, 0x00, 0x08, 0x9f, 0x03, 0x00, 0x00, 0x24,
+	0x04, 0x2f, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02,
+	0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00,
+	0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05,
+	0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01,
+	0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x07, 0xe4, 0x8b, 0x2e, 0x27, 0x24,
+	0x02, 0x2f, 0x2a, 0x07, 0xe4, 0x8b, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x5a, 0x8c,
+	0x20, 0x79, 0xb9, 0x8c, 0xb9, 0x8c, 0x00, 0x00, 0xb9, 0x8c, 0xb9, 0x8c, 0xd4, 0x8c, 0x5c, 0x8c,
+	0x5c, 0x8c, 0x00, 0x00, 0x5c, 0x8c, 0x5c, 0x8c, 0x00, 0x00, 0x34, 0x0f, 0x00, 0x00, 0x00, 0x05,
+	0x04, 0x00, 0x11, 0x00, 0x05, 0x04, 0x00, 0x22, 0x00, 0x05, 0x04, 0x00, 0x33, 0x00, 0x05, 0x04,
+	0x00, 0x44, 0x00, 0x05, 0x04, 0x00, 0x55, 0x00, 0x05, 0x04, 0x00, 0x66, 0x00, 0x05, 0x04, 0x00,
+	0x77, 0x00, 0x05, 0x04, 0x00, 0x88, 0x00, 0x05, 0x04, 0x00, 0x99, 0x00, 0x05, 0x04, 0x00, 0x88,
+	0x00, 0x05, 0x04, 0x00, 0x77, 0x00, 0x05, 0x04, 0x00, 0x66, 0x00, 0x05, 0x04, 0x00, 0x55, 0x00,
+	0x05, 0x04, 0x00, 0x44, 0x00, 0x05, 0x04, 0x00, 0x33, 0x00, 0x05, 0x04, 0x00, 0x22, 0x00, 0x05,
+	0x04, 0x00, 0x11, 0x00, 0x05, 0x04, 0x07, 0x5c, 0x8c, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x2e, 0x3a,
+	0x30, 0x00, 0xc9, 0x8c, 0x0d, 0x25, 0x02, 0x00, 0x00, 0x18, 0x3a, 0x00, 0x26, 0x05, 0x01, 0x2f,
+	0x2a, 0x07, 0x5c, 0x8c, 0x2e, 0x27, 0x24, 0x02, 0x2f, 0x2a, 0x07, 0x5c, 0x8c, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xea, 0x8c, 0x20, 0x79, 0x32, 0x06, 0x01, 0x05, 0x33, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03,
+	0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00,
+	0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05,
+	0x01, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01,
+	0x00, 0x0d, 0x00, 0x05, 0x01, 0x00, 0x0e, 0x00, 0x05, 0x01, 0x07, 0xef, 0x8c, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04,
+	0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x05,
+	0x01, 0x00, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x00, 0x05, 0x01,
+	0x00, 0x0e, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0xca, 0x8d,
+	0x83, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x8d, 0xd5, 0x8d,
+	0x00, 0x00, 0x00, 0x00, 0xdd, 0x8d, 0xdd, 0x8d, 0x00, 0x00, 0x09, 0xa7, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xba, 0x79, 0x08, 0xa8, 0x03, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00, 0x00, 0x00,
+	0x07, 0xdd, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xd5, 0x8d, 0x00, 0x53, 0x43, 0x50, 0x45, 0x18, 0x00,
+	0x00, 0x00, 0x26, 0x8e, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8e, 0x26, 0x8e, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02,
+	0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00,
+	0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x02,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x07, 0x26, 0x8e, 0x00, 0x53, 0x43, 0x50, 0x45,
+	0x14, 0x00, 0x00, 0x00, 0x90, 0x8e, 0x83, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa4, 0x8e, 0x9b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x8e, 0x9e, 0x8e, 0x00, 0x00,
+	0x09, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x07, 0xba, 0x79, 0x00, 0x00,
+	0x00, 0x07, 0x9e, 0x8e, 0x00, 0x00, 0x00, 0x07, 0x9b, 0x8e, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00,
+	0x00, 0x00, 0xce, 0x8e, 0xd4, 0x8e, 0x1a, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x8f, 0x00, 0x00,
+	0x57, 0x8f, 0xba, 0x79, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x8e, 0xce, 0x8e, 0x00, 0x00, 0x00, 0xdd,
+	0x00, 0x07, 0xba, 0x79, 0x18, 0xe5, 0x02, 0x08, 0x99, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x29,
+	0x05, 0x05, 0x01, 0x00, 0xee, 0x00, 0x29, 0x05, 0x05, 0x01, 0x00, 0xff, 0x00, 0x29, 0x05, 0x05,
+	0x01, 0x00, 0x10, 0x01, 0x29, 0x05, 0x05, 0x01, 0x00, 0x21, 0x01, 0x29, 0x05, 0x05, 0x01, 0x00,
+	0xaa, 0x00, 0x29, 0x05, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x05, 0x05, 0x01, 0x00, 0xcc, 0x00,
+	0x29, 0x05, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x07, 0xdf, 0x8e, 0x00, 0x00, 0x00, 0x05, 0x01, 0x2e,
+	0x00, 0x11, 0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x05, 0x01, 0x1c, 0x01, 0x6f, 0x00, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x66, 0x00,
+	0x05, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05,
+	0x01, 0x2f, 0x2a, 0x30, 0x07, 0xce, 0x8e, 0x27, 0x24, 0x02, 0x2a, 0x07, 0xce, 0x8e, 0x53, 0x43,
+	0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x82, 0x8f, 0xae, 0x8f, 0xda, 0x8f, 0xda, 0x8f, 0x00, 0x00,
+	0xda, 0x8f, 0xda, 0x8f, 0x00, 0x00, 0x8d, 0x8f, 0x8d, 0x8f, 0x00, 0x00, 0xb9, 0x8f, 0x8d, 0x8f,
+	0x00, 0x00, 0x09, 0x94, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04, 0x00, 0x00, 0x00,
+	0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x22, 0x00, 0x05, 0x02, 0x00, 0x33, 0x00, 0x05,
+	0x02, 0x00, 0x44, 0x00, 0x05, 0x02, 0x00, 0x55, 0x00, 0x05, 0x02, 0x07, 0x8d, 0x8f, 0x18, 0x49,
+	0x04, 0x0f, 0xe3, 0x01, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x11,
+	0x00, 0x05, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x00, 0x33, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00,
+	0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x02, 0x07, 0xb9, 0x8f, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00,
+	0x77, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00, 0x05, 0x01, 0x00, 0x88,
+	0x00, 0x18, 0x46, 0x04, 0x05, 0x02, 0x00, 0x77, 0x00, 0x05, 0x02, 0x00, 0x66, 0x00, 0x05, 0x02,
+	0x25, 0x02, 0x2a, 0x07, 0x8d, 0x8f, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x12, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x08, 0x3a, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x0e, 0x00, 0x00, 0x00, 0x48, 0x90, 0xe2, 0x90, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xb0, 0x90, 0xb5, 0x90, 0x00, 0x00, 0x09, 0x16, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05,
+	0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x06, 0x01,
+	0x03, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00,
+	0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x09,
+	0x00, 0x05, 0x02, 0x00, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x00, 0x05, 0x02, 0x07, 0x71, 0x90,
+	0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x13, 0x00, 0x05, 0x02, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00,
+	0x11, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x00, 0x05, 0x02, 0x00, 0x0e,
+	0x00, 0x05, 0x02, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x00, 0x05, 0x02, 0x24, 0x04, 0x07,
+	0xba, 0x79, 0x18, 0x3e, 0x03, 0x11, 0x8f, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x53, 0x43,
+	0x50, 0x45, 0x14, 0x00, 0x00, 0x00, 0x22, 0x91, 0x5f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x91, 0x2d, 0x91, 0x00, 0x00, 0x00, 0x00, 0x30, 0x91, 0x30, 0x91,
+	0x00, 0x00, 0x09, 0x9c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79, 0x06, 0x01, 0x03,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x04, 0x05,
+	0x01, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x04, 0x07, 0x30, 0x91,
+	0x00, 0x00, 0x00, 0x07, 0x2d, 0x91, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x62, 0x91,
+	0x00, 0x00, 0x00, 0xfe, 0x01, 0x05, 0x32, 0x00, 0x0f, 0x02, 0x05, 0x32, 0x00, 0x20, 0x02, 0x05,
+	0x32, 0x00, 0x31, 0x02, 0x05, 0x32, 0x00, 0x42, 0x02, 0x05, 0x32, 0x16, 0x53, 0x43, 0x50, 0x45,
+	0x1a, 0x00, 0x00, 0x00, 0xbc, 0x91, 0x2c, 0x92, 0x86, 0x92, 0x86, 0x92, 0x00, 0x00, 0x87, 0x92,
+	0x87, 0x92, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0x00, 0x00, 0x52, 0x92, 0xc1, 0x91, 0x00, 0x00,
+	0x15, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x92, 0x1b, 0x93, 0x00, 0x00, 0x09, 0x9a, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x80, 0xce, 0x91, 0x07, 0xc4, 0x91, 0x1e, 0x80,
+	0xff, 0x91, 0x00, 0x11, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x1f, 0x01,
+	0x00, 0x33, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x55,
+	0x00, 0x05, 0x01, 0x1f, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x1f, 0x01, 0x07, 0xc1, 0x91, 0x00,
+	0x11, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0x22, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0x33, 0x00,
+	0x05, 0x01, 0x20, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x20, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01,
+	0x20, 0x01, 0x00, 0x66, 0x00, 0x05, 0x01, 0x20, 0x01, 0x07, 0xc1, 0x91, 0x18, 0x38, 0x04, 0x34,
+	0x00, 0x00, 0xa9, 0x01, 0x05, 0x02, 0x00, 0xba, 0x01, 0x05, 0x02, 0x00, 0xcb, 0x01, 0x05, 0x02,
+	0x00, 0xdc, 0x01, 0x05, 0x02, 0x00, 0xed, 0x01, 0x05, 0x02, 0x11, 0xe4, 0x01, 0x00, 0x00, 0x05,
+	0x01, 0x16, 0x29, 0x04, 0x05, 0x01, 0x00, 0x11, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x22, 0x00,
+	0x29, 0x04, 0x05, 0x01, 0x00, 0x33, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x44, 0x00, 0x29, 0x04,
+	0x05, 0x01, 0x00, 0x55, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01,
+	0x00, 0x00, 0x00, 0x07, 0x52, 0x92, 0x2e, 0x05, 0x01, 0x18, 0x40, 0x00, 0x26, 0x05, 0x01, 0x2f,
+	0x2a, 0x30, 0x07, 0xba, 0x79, 0x08, 0xa7, 0x01, 0x00, 0x00, 0x18, 0x45, 0x04, 0x00, 0xbb, 0x00,
+	0x05, 0x01, 0x00, 0xcc, 0x00, 0x05, 0x01, 0x00, 0xdd, 0x00, 0x05, 0x01, 0x08, 0xa7, 0x01, 0x00,
+	0x00, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xff, 0x00, 0x05, 0x01, 0x00, 0x10, 0x01, 0x05, 0x01,
+	0x00, 0x21, 0x01, 0x05, 0x01, 0x00, 0x32, 0x01, 0x05, 0x01, 0x00, 0x43, 0x01, 0x05, 0x01, 0x08,
+	0xa7, 0x01, 0x00, 0x00, 0x00, 0xee, 0x00, 0x05, 0x01, 0x00, 0xff, 0x00, 0x05, 0x01, 0x00, 0x10,
+	0x01, 0x05, 0x01, 0x00, 0x21, 0x01, 0x05, 0x01, 0x00, 0x32, 0x01, 0x05, 0x01, 0x00, 0x43, 0x01,
+	0x05, 0x01, 0x08, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x54, 0x01, 0x05, 0x01, 0x00, 0x65, 0x01, 0x05,
+	0x01, 0x00, 0x76, 0x01, 0x05, 0x01, 0x00, 0x87, 0x01, 0x05, 0x01, 0x00, 0x98, 0x01, 0x05, 0x01,
+	0x24, 0x04, 0x07, 0xba, 0x79, 0x00, 0x98, 0x01, 0x07, 0xba, 0x79, 0x06, 0x01, 0x05, 0x09, 0xa7,
+	0x01, 0x00, 0x00, 0x00, 0x77, 0x00, 0x05, 0x01, 0x00, 0x88, 0x00, 0x05, 0x01, 0x00, 0x99, 0x00,
+	0x05, 0x01, 0x00, 0xaa, 0x00, 0x05, 0x01, 0x24, 0x04, 0x07, 0xc1, 0x91, 0x53, 0x43, 0x50, 0x45,
+	0x02, 0x00, 0x00, 0x00, 0x4c, 0x93, 0x76, 0x93, 0x58, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0xf8, 0x03, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x0f, 0x36, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00,
+	0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03,
+	0x00, 0x05, 0x02, 0x07, 0x5f, 0x93, 0x08, 0xd1, 0x03, 0x00, 0x00, 0x1b, 0x05, 0x01, 0x16, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0x90, 0x93, 0xa4, 0x93, 0x99, 0x93, 0x00, 0x00,
+	0x18, 0x54, 0x04, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x42, 0xff, 0x01, 0x00, 0x00, 0x44, 0x05,
+	0x02, 0x07, 0x99, 0x93, 0x18, 0x56, 0x04, 0x08, 0x12, 0x02, 0x00, 0x00, 0x44, 0x05, 0x01, 0x16,
+	0x53, 0x43, 0x50, 0x45, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x93, 0xd6, 0x93, 0xcc, 0x93, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0xff, 0x03, 0x05, 0x01, 0x24, 0x01, 0x05, 0x01, 0x0f, 0xf9, 0x01, 0x00,
+	0x00, 0x05, 0x02, 0x07, 0xcc, 0x93, 0x18, 0xfe, 0x03, 0x08, 0x12, 0x02, 0x00, 0x00, 0x1b, 0x05,
+	0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xee, 0x93, 0x20, 0x79, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00,
+	0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05,
+	0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x53, 0x43, 0x50, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x4a, 0x94,
+	0x77, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x95, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb1, 0x94, 0x5c, 0x94, 0xee, 0x94, 0x09, 0xb1, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x3f, 0x4b, 0x1e, 0x80, 0x61, 0x94, 0x07, 0x52, 0x94, 0x41, 0x01, 0x07, 0x4f,
+	0x94, 0x00, 0x66, 0x00, 0x05, 0x01, 0x00, 0x77, 0x00, 0x05, 0x01, 0x22, 0x03, 0x05, 0x01, 0x00,
+	0x66, 0x00, 0x05, 0x01, 0x07, 0x4f, 0x94, 0x18, 0xe8, 0x03, 0x34, 0x00, 0x00, 0xdd, 0x00, 0x05,
+	0x02, 0x00, 0xde, 0x00, 0x05, 0x02, 0x00, 0xdf, 0x00, 0x05, 0x02, 0x00, 0xe0, 0x00, 0x05, 0x02,
+	0x00, 0xe1, 0x00, 0x05, 0x02, 0x00, 0xe2, 0x00, 0x05, 0x02, 0x00, 0xe3, 0x00, 0x05, 0x02, 0x00,
+	0xe4, 0x00, 0x05, 0x04, 0x00, 0xe5, 0x00, 0x05, 0x04, 0x11, 0xea, 0x01, 0x00, 0x00, 0x05, 0x01,
+	0x16, 0x41, 0x01, 0x29, 0x04, 0x05, 0x01, 0x00, 0x66, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x77,
+	0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x88, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x99, 0x00, 0x29,
+	0x04, 0x05, 0x01, 0x00, 0xaa, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0xbb, 0x00, 0x29, 0x04, 0x05,
+	0x01, 0x00, 0xcc, 0x00, 0x29, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x07, 0xb1, 0x94, 0x00, 0x33,
+	0x00, 0x05, 0x01, 0x24, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00,
+	0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55,
+	0x00, 0x05, 0x01, 0x00, 0x44, 0x00, 0x05, 0x01, 0x00, 0x55, 0x00, 0x05, 0x01, 0x18, 0xfa, 0x03,
+	0x07, 0xf3, 0x94, 0x41, 0x01, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x03, 0x00, 0x22, 0x00, 0x27, 0x24,
+	0x02, 0x05, 0x03, 0x00, 0x11, 0x00, 0x05, 0x03, 0x2f, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xba, 0x79,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x32, 0x00, 0x01, 0x00, 0x05, 0x32, 0x00, 0x02, 0x00, 0x05, 0x32, 0x00, 0x03, 0x00, 0x05, 0x32,
+	0x16, 0x00, 0x53, 0x43, 0x50, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x86, 0x95, 0x96, 0x95, 0xc0, 0x79,
+	0xad, 0x95, 0x00, 0x00, 0xc0, 0x79, 0xad, 0x95, 0x00, 0x00, 0xa2, 0x79, 0xa2, 0x79, 0x00, 0x00,
+	0xa1, 0x95, 0x91, 0x95, 0x00, 0x00, 0x09, 0xac, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0xa2,
+	0x79, 0x41, 0x40, 0x07, 0xa2, 0x79, 0x18, 0x10, 0x04, 0x08, 0x4c, 0x01, 0x00, 0x00, 0x05, 0x03,
+	0x16, 0x08, 0xad, 0x03, 0x00, 0x00, 0x24, 0x40, 0x03, 0x00, 0x07, 0xba, 0x79, 0x05, 0x01, 0x2e,
+	0x25, 0x02, 0x05, 0x0a, 0x25, 0x02, 0x05, 0x0a, 0x25, 0x02, 0x05, 0x0a, 0x25, 0x02, 0x05, 0x0a,
+	0x2f, 0x2a, 0x07, 0xa2, 0x79, 0x00, 0x53, 0x43, 0x50, 0x45, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x95,
+	0x20, 0x79, 0x05, 0x01, 0x1d, 0x07, 0xd2, 0x95, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0xe4, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x3d, 0x00, 0x00, 0x07, 0xba, 0x79, 0x00,
+	0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x07, 0xff,
+	0x95, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x96, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07,
+	0x21, 0x96, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x96, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02,
+	0x07, 0x51, 0x96, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x70, 0x96, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x05,
+	0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x08, 0x00,
+	0x05, 0x02, 0x17, 0x01, 0x02, 0xfd, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02,
+	0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x02, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x05, 0x02, 0x07, 0x73, 0x96, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0xd8, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01,
+	0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00,
+	0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x07, 0xdb,
+	0x96, 0x00, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x97, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07,
+	0x11, 0x97, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x97, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01,
+	0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x05, 0x01, 0x00,
+	0x06, 0x00, 0x05, 0x01, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x05, 0x01, 0x00, 0x09,
+	0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x06, 0x3f, 0x4b, 0x07, 0x41, 0x97, 0x53, 0x43, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00,
+	0x04, 0x00, 0x05, 0x02, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x07,
+	0x00, 0x05, 0x02, 0x07, 0x8b, 0x97, 0x53, 0x43, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x97,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00,
+	0x02, 0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00,
+	0x00, 0x05, 0x01, 0x07, 0xc5, 0x97, 0xc6, 0x00, 0xfc, 0x1c, 0xc7, 0x00, 0x9c, 0x1d, 0xc8, 0x00,
+	0x2c, 0x21, 0x79, 0x01, 0x1a, 0x89, 0x78, 0x01, 0x3a, 0x88, 0x77, 0x01, 0x78, 0x87, 0xda, 0x00,
+	0x0e, 0x1f, 0xd8, 0x00, 0x38, 0x1f, 0xe1, 0x00, 0x80, 0x1f, 0xe2, 0x00, 0x8c, 0x1f, 0xdf, 0x00,
+	0xbc, 0x1f, 0xe0, 0x00, 0xc8, 0x1f, 0xe3, 0x00, 0xf8, 0x1f, 0xe4, 0x00, 0x04, 0x20, 0xdb, 0x00,
+	0x72, 0x22, 0xdd, 0x00, 0xa0, 0x23, 0xde, 0x00, 0xac, 0x23, 0xd6, 0x00, 0xce, 0x23, 0xd9, 0x00,
+	0xe8, 0x23, 0xdc, 0x00, 0xe0, 0x21, 0xc9, 0x00, 0x34, 0x20, 0xca, 0x00, 0x68, 0x20, 0xcb, 0x00,
+	0x9c, 0x20, 0xcc, 0x00, 0xd6, 0x22, 0xcd, 0x00, 0x0a, 0x23, 0xce, 0x00, 0x3e, 0x23, 0xcf, 0x00,
+	0x36, 0x24, 0x4f, 0x01, 0xa0, 0x07, 0x68, 0x00, 0x4a, 0x1e, 0x74, 0x00, 0xf2, 0x20, 0xb0, 0x00,
+	0x9c, 0x22, 0xbb, 0x00, 0x78, 0x24, 0xbd, 0x00, 0xb2, 0x24, 0x97, 0x01, 0xb2, 0x89, 0x98, 0x01,
+	0xf2, 0x89, 0x9a, 0x01, 0x5c, 0x8e, 0x60, 0x01, 0xec, 0x24, 0x92, 0x00, 0x1e, 0x25, 0x93, 0x00,
+	0xb2, 0x25, 0x94, 0x00, 0xc0, 0x26, 0x95, 0x00, 0x5c, 0x27, 0x6d, 0x01, 0x34, 0x8b, 0x6e, 0x01,
+	0x36, 0x8c, 0x6f, 0x01, 0xde, 0x8c, 0x70, 0x01, 0x3e, 0x8d, 0x97, 0x00, 0xbc, 0x27, 0x98, 0x00,
+	0x6a, 0x29, 0x74, 0x01, 0xaa, 0x8e, 0x99, 0x00, 0x16, 0x28, 0x9a, 0x00, 0x44, 0x29, 0x9b, 0x00,
+	0x1e, 0x2a, 0x9c, 0x00, 0x70, 0x2a, 0x9d, 0x00, 0xd2, 0x2a, 0xa1, 0x00, 0x32, 0x2b, 0x9e, 0x00,
+	0xc2, 0x2b, 0x9f, 0x00, 0xd4, 0x2c, 0xa0, 0x00, 0x78, 0x2d, 0xa5, 0x00, 0xc0, 0x2d, 0xa3, 0x00,
+	0x1c, 0x2e, 0xa4, 0x00, 0x50, 0x2e, 0x71, 0x01, 0x52, 0x8a, 0x73, 0x01, 0x3e, 0x82, 0xa6, 0x00,
+	0x14, 0x2f, 0xa7, 0x00, 0x68, 0x2f, 0xa8, 0x00, 0xe8, 0x2f, 0xaa, 0x00, 0x54, 0x30, 0xab, 0x00,
+	0xa8, 0x30, 0xac, 0x00, 0x04, 0x31, 0xad, 0x00, 0x5c, 0x31, 0xae, 0x00, 0xb0, 0x31, 0xaf, 0x00,
+	0x0c, 0x32, 0xd4, 0x00, 0x48, 0x33, 0xd2, 0x00, 0xb0, 0x32, 0xb1, 0x00, 0x60, 0x32, 0xb2, 0x00,
+	0x16, 0x37, 0xb3, 0x00, 0xd4, 0x32, 0xb4, 0x00, 0x60, 0x33, 0xb5, 0x00, 0xb4, 0x33, 0xb6, 0x00,
+	0x06, 0x34, 0xb7, 0x00, 0x5a, 0x34, 0xb8, 0x00, 0x70, 0x37, 0xb9, 0x00, 0xc0, 0x34, 0xba, 0x00,
+	0xe0, 0x37, 0xbc, 0x00, 0x1c, 0x35, 0xbe, 0x00, 0x70, 0x35, 0xc0, 0x00, 0x3c, 0x30, 0xa9, 0x00,
+	0xd4, 0x36, 0xc1, 0x00, 0xc4, 0x35, 0xbf, 0x00, 0x42, 0x36, 0x96, 0x01, 0x96, 0x8d, 0x99, 0x01,
+	0xea, 0x8d, 0xe9, 0x00, 0xa2, 0x56, 0xea, 0x00, 0xca, 0x56, 0xe8, 0x00, 0xac, 0x58, 0xeb, 0x00,
+	0x34, 0x57, 0xe6, 0x00, 0x90, 0x57, 0xe7, 0x00, 0x66, 0x59, 0xec, 0x00, 0x7c, 0x17, 0x75, 0x01,
+	0x72, 0x83, 0xe5, 0x00, 0x88, 0x0d, 0x0c, 0x01, 0x0c, 0x0e, 0x00, 0x00, 0x48, 0x38, 0x02, 0x00,
+	0xd4, 0x38, 0x03, 0x00, 0xee, 0x38, 0x04, 0x00, 0x28, 0x39, 0x05, 0x00, 0xde, 0x39, 0x06, 0x00,
+	0x04, 0x3a, 0x07, 0x00, 0xbc, 0x1c, 0x09, 0x00, 0x22, 0x3b, 0x0a, 0x00, 0x56, 0x3c, 0x0b, 0x00,
+	0x7c, 0x3c, 0x0c, 0x00, 0xa0, 0x3d, 0x0d, 0x00, 0xc6, 0x3d, 0x61, 0x01, 0x20, 0x90, 0x0f, 0x00,
+	0xc8, 0x3e, 0x10, 0x00, 0x12, 0x53, 0x11, 0x00, 0x5c, 0x3f, 0x65, 0x01, 0x5e, 0x8f, 0x66, 0x01,
+	0xd0, 0x86, 0x67, 0x01, 0x06, 0x90, 0x64, 0x01, 0x56, 0x91, 0x12, 0x00, 0x76, 0x3f, 0x13, 0x00,
+	0x42, 0x41, 0x62, 0x01, 0x7c, 0x91, 0x14, 0x00, 0x54, 0x44, 0x15, 0x00, 0x64, 0x41, 0x16, 0x00,
+	0xc0, 0x41, 0x17, 0x00, 0xfa, 0x41, 0x18, 0x00, 0x78, 0x42, 0x19, 0x00, 0x92, 0x42, 0x1a, 0x00,
+	0xfc, 0x42, 0x1b, 0x00, 0x16, 0x43, 0x1c, 0x00, 0xd8, 0x43, 0x1d, 0x00, 0xc8, 0x45, 0x1e, 0x00,
+	0x58, 0x47, 0x25, 0x00, 0x7e, 0x47, 0x0e, 0x00, 0x7e, 0x3e, 0x1f, 0x00, 0xa4, 0x47, 0x20, 0x00,
+	0xc0, 0x48, 0x27, 0x00, 0x84, 0x4b, 0x26, 0x00, 0xea, 0x51, 0x28, 0x00, 0x42, 0x49, 0x29, 0x00,
+	0xe6, 0x48, 0x2a, 0x00, 0x40, 0x4a, 0x2b, 0x00, 0xa2, 0x4a, 0x3b, 0x00, 0xc4, 0x50, 0x2c, 0x00,
+	0x18, 0x4b, 0x2d, 0x00, 0x16, 0x4c, 0x2e, 0x00, 0x82, 0x4c, 0xd3, 0x00, 0x74, 0x52, 0xd0, 0x00,
+	0x50, 0x52, 0x2f, 0x00, 0x0a, 0x22, 0x30, 0x00, 0x42, 0x4e, 0x31, 0x00, 0x9e, 0x4e, 0x32, 0x00,
+	0x00, 0x4f, 0x33, 0x00, 0x62, 0x4f, 0x34, 0x00, 0xce, 0x4f, 0x95, 0x01, 0xee, 0x90, 0x35, 0x00,
+	0x7c, 0x50, 0x36, 0x00, 0x48, 0x50, 0x37, 0x00, 0xf2, 0x43, 0x38, 0x00, 0xaa, 0x49, 0x39, 0x00,
+	0x26, 0x51, 0x3a, 0x00, 0x88, 0x51, 0x24, 0x00, 0x8c, 0x52, 0x08, 0x00, 0xea, 0x52, 0x3d, 0x00,
+	0x18, 0x54, 0x3e, 0x00, 0x9e, 0x54, 0x3f, 0x00, 0x58, 0x55, 0x40, 0x00, 0x80, 0x55, 0x41, 0x00,
+	0x82, 0x56, 0x3c, 0x00, 0xf6, 0x53, 0xff, 0x00, 0x30, 0x59, 0x08, 0x01, 0xfa, 0x59, 0x0a, 0x01,
+	0xa8, 0x5a, 0x00, 0x01, 0xd6, 0x5b, 0x0b, 0x01, 0x0c, 0x59, 0x02, 0x01, 0x00, 0x5b, 0x7c, 0x01,
+	0xe2, 0x93, 0x09, 0x01, 0x3a, 0x1a, 0x0d, 0x01, 0x7a, 0x1a, 0x0e, 0x01, 0xb0, 0x13, 0x01, 0x01,
+	0xe6, 0x0e, 0x04, 0x01, 0x54, 0x0f, 0x03, 0x01, 0xc6, 0x10, 0x05, 0x01, 0x0a, 0x0f, 0x06, 0x01,
+	0x86, 0x0f, 0x7d, 0x01, 0x4a, 0x86, 0x7e, 0x01, 0x8e, 0x86, 0x8b, 0x01, 0x80, 0x93, 0x5e, 0x00,
+	0x16, 0x5c, 0x5f, 0x00, 0x6a, 0x5c, 0x60, 0x00, 0xb6, 0x5c, 0x61, 0x00, 0x78, 0x5d, 0x62, 0x00,
+	0xc6, 0x5d, 0x63, 0x00, 0x18, 0x5e, 0x64, 0x00, 0x74, 0x5e, 0x65, 0x00, 0xd8, 0x5e, 0x66, 0x00,
+	0x54, 0x5f, 0x67, 0x00, 0xe6, 0x5f, 0x69, 0x00, 0x74, 0x60, 0x6a, 0x00, 0xd0, 0x60, 0x6b, 0x00,
+	0x30, 0x61, 0x6c, 0x00, 0x90, 0x61, 0x6d, 0x00, 0xfe, 0x61, 0x6f, 0x00, 0x5a, 0x63, 0x70, 0x00,
+	0x08, 0x64, 0x71, 0x00, 0x4a, 0x62, 0x72, 0x00, 0xa0, 0x62, 0x73, 0x00, 0x0e, 0x63, 0x75, 0x00,
+	0x5a, 0x64, 0x76, 0x00, 0xd0, 0x64, 0xd5, 0x00, 0x24, 0x6b, 0xd1, 0x00, 0x00, 0x6b, 0x78, 0x00,
+	0x84, 0x65, 0x77, 0x00, 0x34, 0x65, 0x79, 0x00, 0x6a, 0x67, 0x7a, 0x00, 0xd4, 0x67, 0x7b, 0x00,
+	0x42, 0x68, 0x7c, 0x00, 0x90, 0x68, 0x7d, 0x00, 0xb2, 0x68, 0x7e, 0x00, 0x42, 0x69, 0x7f, 0x00,
+	0xd0, 0x69, 0x80, 0x00, 0xd8, 0x65, 0x81, 0x00, 0x38, 0x66, 0x82, 0x00, 0xa6, 0x66, 0x83, 0x00,
+	0xf2, 0x66, 0x86, 0x00, 0x1c, 0x6a, 0x87, 0x00, 0xae, 0x6a, 0x5c, 0x00, 0x6c, 0x73, 0x5d, 0x00,
+	0x08, 0x74, 0x5a, 0x00, 0x94, 0x74, 0x5b, 0x00, 0x06, 0x75, 0x88, 0x00, 0x3c, 0x6b, 0x89, 0x00,
+	0xdc, 0x6b, 0x42, 0x00, 0x42, 0x6c, 0x43, 0x00, 0x8a, 0x1e, 0x44, 0x00, 0x9a, 0x6c, 0x45, 0x00,
+	0xde, 0x6c, 0x46, 0x00, 0xe2, 0x6d, 0x47, 0x00, 0x72, 0x6f, 0x48, 0x00, 0x06, 0x6e, 0x49, 0x00,
+	0x76, 0x15, 0x4a, 0x00, 0x48, 0x16, 0x4b, 0x00, 0x8e, 0x6f, 0x4c, 0x00, 0x2a, 0x70, 0x4d, 0x00,
+	0x46, 0x75, 0x4e, 0x00, 0xc8, 0x70, 0x4f, 0x00, 0x92, 0x72, 0x50, 0x00, 0xec, 0x70, 0x68, 0x01,
+	0x26, 0x94, 0x69, 0x01, 0x40, 0x95, 0x51, 0x00, 0x3c, 0x72, 0x52, 0x00, 0xae, 0x72, 0x54, 0x00,
+	0xf2, 0x72, 0x56, 0x00, 0xa0, 0x76, 0x57, 0x00, 0xe2, 0x76, 0x58, 0x00, 0xbe, 0x77, 0x59, 0x00,
+	0x0e, 0x78, 0x6a, 0x01, 0x62, 0x95, 0x8a, 0x00, 0x38, 0x78, 0x8b, 0x00, 0x78, 0x78, 0x8c, 0x00,
+	0xb8, 0x78, 0x8d, 0x00, 0xe0, 0x78, 0x8e, 0x00, 0x9c, 0x1a, 0x8f, 0x00, 0xd6, 0x1a, 0x90, 0x00,
+	0x16, 0x1b, 0xed, 0x00, 0xaa, 0x59, 0xee, 0x00, 0x52, 0x5b, 0xef, 0x00, 0x34, 0x58, 0xf2, 0x00,
+	0x68, 0x58, 0x7b, 0x01, 0x3c, 0x93, 0xf0, 0x00, 0xda, 0x58, 0x7a, 0x01, 0xb0, 0x93, 0xf3, 0x00,
+	0x32, 0x0b, 0xf6, 0x00, 0x14, 0x15, 0xf1, 0x00, 0x32, 0x0a, 0xf4, 0x00, 0xce, 0x0b, 0xf5, 0x00,
+	0xe4, 0x0b, 0xf7, 0x00, 0xe8, 0x57, 0xf8, 0x00, 0x18, 0x58, 0x85, 0x00, 0xaa, 0x15, 0xfa, 0x00,
+	0x14, 0x11, 0xfb, 0x00, 0x96, 0x10, 0xf9, 0x00, 0x08, 0x57, 0x24, 0x01, 0xb6, 0x5b, 0x23, 0x01,
+	0x5c, 0x05, 0xd7, 0x00, 0xe2, 0x12, 0x20, 0x01, 0x42, 0x07, 0x28, 0x01, 0xa4, 0x09, 0x29, 0x01,
+	0x08, 0x0a, 0x12, 0x01, 0x70, 0x07, 0x2a, 0x01, 0xb2, 0x07, 0x2b, 0x01, 0xc0, 0x08, 0x76, 0x01,
+	0xe4, 0x81, 0x2c, 0x01, 0x74, 0x08, 0x2d, 0x01, 0x9c, 0x08, 0x4a, 0x01, 0x2e, 0x09, 0x4b, 0x01,
+	0x64, 0x09, 0x2e, 0x01, 0x8a, 0x0e, 0x2f, 0x01, 0x60, 0x0e, 0x7f, 0x01, 0x9e, 0x82, 0x80, 0x01,
+	0xaa, 0x82, 0x81, 0x01, 0xb6, 0x82, 0x82, 0x01, 0xc2, 0x82, 0x15, 0x01, 0x5e, 0x11, 0x38, 0x01,
+	0x8a, 0x12, 0x16, 0x01, 0x28, 0x08, 0x1d, 0x01, 0x48, 0x14, 0x17, 0x01, 0x8c, 0x19, 0x19, 0x01,
+	0x1e, 0x13, 0x1b, 0x01, 0x7c, 0x0a, 0x1c, 0x01, 0x7a, 0x13, 0xfe, 0x00, 0xe0, 0x13, 0x21, 0x01,
+	0x96, 0x79, 0x30, 0x01, 0xb2, 0x0f, 0x25, 0x01, 0x0a, 0x0b, 0x26, 0x01, 0x62, 0x0b, 0x27, 0x01,
+	0xa6, 0x0b, 0x4c, 0x01, 0xd8, 0x79, 0x48, 0x01, 0x0e, 0x06, 0x49, 0x01, 0x1a, 0x06, 0x39, 0x01,
+	0xd4, 0x14, 0x22, 0x01, 0xf4, 0x12, 0xa2, 0x00, 0x2a, 0x17, 0x72, 0x01, 0x42, 0x83, 0x86, 0x01,
+	0xb0, 0x83, 0x87, 0x01, 0x0e, 0x86, 0x88, 0x01, 0x1e, 0x84, 0x89, 0x01, 0x94, 0x84, 0x85, 0x01,
+	0x1c, 0x85, 0x8a, 0x01, 0xcc, 0x85, 0x0f, 0x01, 0x88, 0x16, 0x10, 0x01, 0x64, 0x16, 0x36, 0x01,
+	0xfc, 0x17, 0x35, 0x01, 0x64, 0x19, 0x34, 0x01, 0x06, 0x19, 0x13, 0x01, 0x06, 0x7a, 0x14, 0x01,
+	0x5a, 0x17, 0x1a, 0x01, 0x54, 0x13, 0x44, 0x01, 0x4c, 0x06, 0x45, 0x01, 0x58, 0x06, 0x11, 0x01,
+	0xd0, 0x19, 0xfd, 0x00, 0x26, 0x11, 0x37, 0x01, 0x0a, 0x1a, 0x33, 0x01, 0xe0, 0x0f, 0x32, 0x01,
+	0x1a, 0x10, 0x91, 0x00, 0xbc, 0x18, 0x53, 0x00, 0xac, 0x1b, 0xfc, 0x00, 0xdc, 0x1b, 0x21, 0x00,
+	0x3c, 0x1c, 0x22, 0x00, 0x72, 0x1c, 0x3a, 0x01, 0xa0, 0x11, 0x3b, 0x01, 0x36, 0x12, 0x1e, 0x01,
+	0x9e, 0x14, 0x31, 0x01, 0x18, 0x18, 0x1f, 0x01, 0xe8, 0x16, 0x3c, 0x01, 0x90, 0x05, 0x3e, 0x01,
+	0x4e, 0x0c, 0x3d, 0x01, 0xb8, 0x0c, 0x4e, 0x01, 0xee, 0x79, 0x84, 0x01, 0xc6, 0x95, 0x4d, 0x01,
+	0xc0, 0x16, 0x3f, 0x01, 0x20, 0x0d, 0x40, 0x01, 0x50, 0x0d, 0x18, 0x01, 0x6a, 0x1b, 0x41, 0x01,
+	0xbc, 0x0a, 0x9b, 0x01, 0x3e, 0x87, 0x46, 0x01, 0x8a, 0x06, 0x47, 0x01, 0x96, 0x06, 0x42, 0x01,
+	0xe6, 0x06, 0x43, 0x01, 0xf2, 0x06, 0x50, 0x01, 0x18, 0x7a, 0x51, 0x01, 0x2a, 0x7a, 0x83, 0x01,
+	0xd8, 0x95, 0x52, 0x01, 0x40, 0x7a, 0x53, 0x01, 0x70, 0x7a, 0x54, 0x01, 0xaa, 0x7a, 0x55, 0x01,
+	0x60, 0x7b, 0x59, 0x01, 0x18, 0x7c, 0x5a, 0x01, 0x28, 0x7d, 0x5b, 0x01, 0x80, 0x7d, 0x5c, 0x01,
+	0x60, 0x7e, 0x5d, 0x01, 0xf8, 0x7e, 0x5e, 0x01, 0x94, 0x7f, 0x5f, 0x01, 0x68, 0x80, 0x56, 0x01,
+	0x40, 0x81, 0x57, 0x01, 0x78, 0x81, 0x58, 0x01, 0xb6, 0x81, 0x8e, 0x01, 0xb6, 0x97, 0x8c, 0x01,
+	0xcc, 0x96, 0x8d, 0x01, 0x02, 0x97, 0x8f, 0x01, 0x32, 0x97, 0x90, 0x01, 0x7c, 0x97, 0x91, 0x01,
+	0xf0, 0x95, 0x92, 0x01, 0x12, 0x96, 0x93, 0x01, 0x42, 0x96, 0x94, 0x01, 0x64, 0x96, 0xff, 0xff,
+	0x00, 0x00,
+};
+const size_t origIScriptSize = 40482;
@@ -0,0 +1,17 @@
+#pragma once
+
+#ifndef ORIGMODEL_HEADER_
+#define ORIGMODEL_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Original iscript.bin, compiled in as a static table by iscript_gen.
+origmodel.cpp is regenerated whenever iscript.bin changes.
+*/
+
+extern const uint8_t origIScriptData[];
+extern const size_t origIScriptSize;
+
+#endif
@@ -0,0 +1,124 @@
+#include "outputcache.h"
+#include "fixer.h"
+#include "mappedfile.h"
+#include "structhash.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fstream>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// Bump whenever the same input & options may produce different output.
+static const uint64_t CACHE_VERSION = 1;
+
+// Two independent 64bit hashes make a 128bit key.
+static const uint64_t KEY_SEED[2] =
+{
+	0xCBF29CE484222325ull,  // FNV offset basis
+	0x84222325CBF29CE4ull,
+};
+
+static bool MakeDirectory(const std::string& dir)
+{
+#ifdef _WIN32
+	return _mkdir(dir.c_str()) == 0 || errno == EEXIST;
+#else
+	return mkdir(dir.c_str(), 0777) == 0 || errno == EEXIST;
+#endif
+}
+
+static void AppendHex(std::string* s, uint64_t v, int digits)
+{
+	for(int i = digits - 1; i >= 0; i--)
+	{
+		s->push_back("0123456789abcdef"[(v >> (i * 4)) & 15]);
+	}
+}
+
+static bool WriteWholeFile(const std::string& fname, const uint8_t* data, size_t size)
+{
+	std::ofstream os(fname, std::ofstream::binary);
+	if(!os) return false;
+	os.write((const char*)data, size);
+	os.close();
+	return !os.fail();
+}
+
+OutputCache::OutputCache(
+	const std::string& dir,
+	const OriginalIScript& orig,
+	const FixOptions& options)
+	: _dir(dir)
+{
+	MakeDirectory(_dir);
+
+	uint64_t optionBits =
+		(options.contentDiff ? 1 : 0) |
+		(options.dedup ? 2 : 0) |
+		(options.optimize ? 4 : 0) |
+		(options.fillGaps ? 8 : 0) |
+		(options.compact ? 16 : 0);
+	for(int i = 0; i < 2; i++)
+	{
+		uint64_t h = HashBytes(orig.data, orig.size, KEY_SEED[i]);
+		h = HashMix(h, orig.size);
+		h = HashMix(h, optionBits);
+		_baseHash[i] = HashMix(h, CACHE_VERSION);
+	}
+}
+
+std::string OutputCache::GetKey(const std::string& ifname) const
+{
+	MappedFile input(ifname);
+	if(!input.IsOpen()) return std::string();
+
+	std::string key;
+	for(int i = 0; i < 2; i++)
+	{
+		uint64_t h = HashBytes(input.data(), input.size(), _baseHash[i]);
+		AppendHex(&key, HashMix(h, input.size()), 16);
+	}
+	return key;
+}
+
+std::string OutputCache::GetPath(const std::string& key) const
+{
+	return _dir + "/" + key + ".bin";
+}
+
+bool OutputCache::Fetch(const std::string& key, const std::string& ofname) const
+{
+	MappedFile cached(GetPath(key));
+	if(!cached.IsOpen()) return false;
+
+	MappedOutputFile output;
+	if(!output.Create(ofname, cached.size())) return false;
+	memcpy(output.data(), cached.data(), cached.size());
+	return output.Commit();
+}
+
+void OutputCache::Store(const std::string& key, const std::string& ofname) const
+{
+	MappedFile output(ofname);
+	if(!output.IsOpen()) return;
+
+	// Write aside and rename, so a concurrent Fetch never sees a partial
+	// file. Same key means same content, so losing the race is harmless.
+	std::string path = GetPath(key);
+	std::string tmpPath = path + ".";
+	AppendHex(&tmpPath,
+		HashBytes((const uint8_t*)ofname.data(), ofname.size(), KEY_SEED[0]), 8);
+	tmpPath += ".tmp";
+	if(!WriteWholeFile(tmpPath, output.data(), output.size()) ||
+		rename(tmpPath.c_str(), path.c_str()) != 0)
+	{
+		remove(tmpPath.c_str());
+	}
+}
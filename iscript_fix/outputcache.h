@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef OUTPUTCACHE_HEADER_
+#define OUTPUTCACHE_HEADER_
+
+#include <cstdint>
+#include <string>
+
+struct FixOptions;
+struct OriginalIScript;
+
+/*
+Fixed outputs kept in a directory, named by a hash of everything the
+output depends on : input bytes, original iscript bytes and options.
+Output is a pure function of those, so an input seen before gets its old
+output copied back without decoding anything.
+*/
+class OutputCache
+{
+public:
+	OutputCache(
+		const std::string& dir,
+		const OriginalIScript& orig,
+		const FixOptions& options);
+
+	// Key of input at ifname. Empty if it can't be read.
+	std::string GetKey(const std::string& ifname) const;
+
+	// Copy output cached for key to ofname. False on miss.
+	bool Fetch(const std::string& key, const std::string& ofname) const;
+
+	// Keep ofname as output for key. Failing to is not an error.
+	void Store(const std::string& key, const std::string& ofname) const;
+
+private:
+	std::string GetPath(const std::string& key) const;
+
+	std::string _dir;
+	uint64_t _baseHash[2];
+};
+
+#endif
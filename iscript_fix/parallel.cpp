@@ -0,0 +1,99 @@
+#include "parallel.h"
+
+#include <exception>
+
+void ParallelRanges(
+	unsigned rangeCount,
+	size_t n,
+	const std::function<void(unsigned, size_t, size_t)>& fn)
+{
+	if(rangeCount <= 1)
+	{
+		fn(0, 0, n);
+		return;
+	}
+
+	// What a range throws is passed on to the caller once every range is
+	// done, so no thread outlives the call.
+	std::vector<std::exception_ptr> errors(rangeCount);
+	auto runRange = [&](unsigned r, size_t begin, size_t end)
+	{
+		try { fn(r, begin, end); }
+		catch(...) { errors[r] = std::current_exception(); }
+	};
+
+	std::vector<std::thread> threads;
+	for(unsigned r = 1; r < rangeCount; r++)
+	{
+		size_t begin = n * r / rangeCount;
+		size_t end = n * (r + 1) / rangeCount;
+		threads.push_back(std::thread(runRange, r, begin, end));
+	}
+	runRange(0, 0, n / rangeCount);
+	for(std::thread& th : threads) th.join();
+	for(std::exception_ptr& error : errors)
+	{
+		if(error) std::rethrow_exception(error);
+	}
+}
+
+unsigned GetHardwareThreads()
+{
+	unsigned n = std::thread::hardware_concurrency();
+	return n ? n : 1;
+}
+
+ThreadPool::ThreadPool(unsigned threadCount) : _pending(0), _stopping(false)
+{
+	if(threadCount == 0) threadCount = 1;
+	for(unsigned i = 0; i < threadCount; i++)
+	{
+		_workers.push_back(std::thread(&ThreadPool::WorkerMain, this));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_jobReady.notify_all();
+	for(std::thread& th : _workers) th.join();
+}
+
+void ThreadPool::Submit(const std::function<void()>& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_jobs.push_back(job);
+		_pending++;
+	}
+	_jobReady.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while(_pending != 0) _allDone.wait(lock);
+}
+
+void ThreadPool::WorkerMain()
+{
+	while(1)
+	{
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			while(_jobs.empty() && !_stopping) _jobReady.wait(lock);
+			if(_jobs.empty()) break;
+			job = _jobs.front();
+			_jobs.pop_front();
+		}
+
+		job();
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		if(--_pending == 0) _allDone.notify_all();
+	}
+}
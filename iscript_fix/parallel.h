@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef PARALLEL_HEADER_
+#define PARALLEL_HEADER_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Split [0, n) into rangeCount contiguous ranges and run
+fn(rangeIndex, begin, end) for each on its own thread. Range 0 runs on
+the calling thread. Returns after every range is done, then rethrows
+what the lowest throwing range threw.
+*/
+void ParallelRanges(
+	unsigned rangeCount,
+	size_t n,
+	const std::function<void(unsigned, size_t, size_t)>& fn);
+
+// Number of hardware threads, at least 1.
+unsigned GetHardwareThreads();
+
+/*
+Per-worker deque for work stealing. The owner pushes and pops at the back,
+so it works depth-first on its own items, while thieves take the oldest
+items from the front. Each deque has its own lock and is touched by other
+workers only when they run out of work.
+*/
+template<typename T>
+class WorkStealingDeque
+{
+public:
+	void Push(const T& item)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_items.push_back(item);
+	}
+
+	bool Pop(T* item)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if(_items.empty()) return false;
+		*item = _items.back();
+		_items.pop_back();
+		return true;
+	}
+
+	bool Steal(T* item)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if(_items.empty()) return false;
+		*item = _items.front();
+		_items.pop_front();
+		return true;
+	}
+
+private:
+	std::mutex _mutex;
+	std::deque<T> _items;
+};
+
+/*
+Fixed number of worker threads running submitted jobs in FIFO order.
+Wait() blocks until every job submitted so far has finished. Workers
+stop when the pool is destroyed.
+*/
+class ThreadPool
+{
+public:
+	explicit ThreadPool(unsigned threadCount);
+	~ThreadPool();
+
+	void Submit(const std::function<void()>& job);
+	void Wait();
+
+private:
+	void WorkerMain();
+
+	std::vector<std::thread> _workers;
+	std::deque<std::function<void()>> _jobs;
+	std::mutex _mutex;
+	std::condition_variable _jobReady;
+	std::condition_variable _allDone;
+	size_t _pending;
+	bool _stopping;
+
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+};
+
+#endif
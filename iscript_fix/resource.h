@@ -1,3 +0,0 @@
-#pragma once
-
-#define IDR_RCDATA1 101
@@ -0,0 +1,175 @@
+#include "server.h"
+#include "fixer.h"
+#include "iscript.h"
+#include "iscriptdiff.h"
+#include "log.h"
+
+#include <cstring>
+
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+// What a client got last time.
+struct ClientState
+{
+	ClientState() : status(FIX_OK), lastRequest(0) {}
+
+	std::vector<uint8_t> input;
+	// Decoded from input, unless that failed. input is only ever swapped,
+	// so this keeps pointing at its buffer.
+	std::unique_ptr<IScript> model;
+	uint32_t status;
+	std::vector<uint8_t> output;
+	std::string log;
+	uint64_t lastRequest;  // Number of the latest request it sent
+};
+
+static void ForgetLeastRecentClient(std::map<uint32_t, ClientState>* clients)
+{
+	auto oldest = clients->begin();
+	for(auto it = clients->begin(); it != clients->end(); ++it)
+	{
+		if(it->second.lastRequest < oldest->second.lastRequest) oldest = it;
+	}
+	if(oldest != clients->end()) clients->erase(oldest);
+}
+
+static bool ReadU32(FILE* in, uint32_t* value)
+{
+	uint8_t buf[4];
+	if(fread(buf, 1, 4, in) != 4) return false;
+	*value = buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+	return true;
+}
+
+static void AppendU32(std::vector<uint8_t>* out, uint32_t value)
+{
+	for(int i = 0; i < 4; i++) out->push_back((uint8_t)(value >> (i * 8)));
+}
+
+// logPrefix goes before the log of state.
+static bool WriteReply(FILE* out, const ClientState& state, const std::string& logPrefix)
+{
+	std::vector<uint8_t> header;
+	AppendU32(&header, state.status);
+	AppendU32(&header, (uint32_t)state.output.size());
+	AppendU32(&header, (uint32_t)(logPrefix.size() + state.log.size()));
+	if(fwrite(header.data(), 1, header.size(), out) != header.size()) return false;
+	if(!state.output.empty() &&
+		fwrite(state.output.data(), 1, state.output.size(), out) != state.output.size())
+	{
+		return false;
+	}
+	if(!logPrefix.empty() &&
+		fwrite(logPrefix.data(), 1, logPrefix.size(), out) != logPrefix.size())
+	{
+		return false;
+	}
+	if(!state.log.empty() &&
+		fwrite(state.log.data(), 1, state.log.size(), out) != state.log.size())
+	{
+		return false;
+	}
+	return fflush(out) == 0;
+}
+
+/*
+Fix input for a client, on top of the model of what it sent last time :
+only code its edits touched gets decoded again.
+*/
+static void FixInput(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	ClientState* state,
+	std::vector<uint8_t>& input)
+{
+	std::unique_ptr<IScript> model;
+	BufferFixOutput output;
+	state->status = FIX_MALFORMED_INPUT;
+	try
+	{
+		Log("[2] Reading custom iscript.\n");
+		model = ReadEditedIScript(input.data(), input.size(),
+			state->model.get(), state->input.data(), state->input.size());
+		Log("\n");
+		state->status = FixIScriptModel(orig, *model, &output, options);
+	}
+	catch(const FatalErrorException& e)
+	{
+		Log("\n[Error] %s\n", e.what());
+	}
+	catch(const std::bad_alloc&)
+	{
+		Log("\n[Error] Out of memory.\n");
+		state->status = FIX_OUT_OF_MEMORY;
+	}
+	if(state->status == FIX_MALFORMED_INPUT || state->status == FIX_OUT_OF_MEMORY)
+	{
+		model.reset();
+	}
+
+	state->input.swap(input);
+	state->model = std::move(model);
+	state->output.swap(output.buffer);
+	if(state->status != FIX_OK) state->output.clear();
+}
+
+int RunServer(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	const std::string& prepareLog,
+	FILE* in,
+	FILE* out)
+{
+#ifdef _WIN32
+	// Requests & replies are binary. Text mode would mangle 0x0A & 0x1A.
+	_setmode(_fileno(in), _O_BINARY);
+	_setmode(_fileno(out), _O_BINARY);
+#endif
+
+	std::map<uint32_t, ClientState> clients;
+	std::vector<uint8_t> input;
+	uint64_t requestCount = 0;
+	std::string logPrefix = prepareLog;  // Until the first reply
+	while(true)
+	{
+		uint32_t clientID, inputSize;
+		if(!ReadU32(in, &clientID)) return 0;  // End of requests
+		if(!ReadU32(in, &inputSize) || inputSize > SERVER_MAX_REQUEST) return -1;
+		input.resize(inputSize);
+		if(inputSize && fread(input.data(), 1, inputSize, in) != inputSize) return -1;
+
+		if(inputSize == 0)
+		{
+			clients.erase(clientID);
+			if(!WriteReply(out, ClientState(), logPrefix)) return -1;
+			logPrefix.clear();
+			continue;
+		}
+
+		if(!clients.count(clientID) && clients.size() >= SERVER_MAX_CLIENTS)
+		{
+			ForgetLeastRecentClient(&clients);
+		}
+		ClientState& state = clients[clientID];
+		state.lastRequest = ++requestCount;
+		if(state.input != input)
+		{
+			// Log goes into the reply. Out is the reply stream itself.
+			state.log.clear();
+			SetLogCapture(&state.log);
+			FixInput(orig, options, &state, input);
+			SetLogCapture(nullptr);
+		}
+		if(!WriteReply(out, state, logPrefix)) return -1;
+		logPrefix.clear();
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef SERVER_HEADER_
+#define SERVER_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <string>
+
+struct FixOptions;
+struct OriginalIScript;
+
+/*
+Server mode. Original iscript is prepared once by the caller, then fix
+requests are read from in and answered on out until in ends. All
+integers are u32 little endian.
+
+Request : client ID, input size, input bytes.
+Reply   : status, output size, log size, output bytes, log bytes.
+
+Status is a FixStatus, FIX_OK being 0. The log is what a command line
+run would have printed for that input.
+
+Each client ID keeps its last input, the model decoded from it and its
+reply. An unchanged input is answered without fixing it again, and a
+changed one only decodes what its edits touched. A request with no input
+bytes forgets what its client kept, and gets an empty FIX_OK reply.
+Past SERVER_MAX_CLIENTS clients, the one that went longest without a
+request is forgotten the same way.
+*/
+
+// Requests larger than this end the server, as the stream is broken.
+const uint32_t SERVER_MAX_REQUEST = 16 << 20;
+
+// Each client keeps about 1MB of decoded model.
+const size_t SERVER_MAX_CLIENTS = 32;
+
+// prepareLog, what preparing orig logged, starts the log of the first
+// reply, as a command line run prints it first too. Returns 0 when in
+// ended cleanly, -1 when a request was broken or a reply couldn't be
+// written.
+int RunServer(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	const std::string& prepareLog,
+	FILE* in,
+	FILE* out);
+
+#endif
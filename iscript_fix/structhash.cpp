@@ -0,0 +1,166 @@
+#include "structhash.h"
+
+static const uint64_t FNV_OFFSET = 0xCBF29CE484222325ull;
+static const uint64_t FNV_PRIME = 0x100000001B3ull;
+
+uint64_t HashMix(uint64_t h, uint64_t v)
+{
+	// splitmix64 finalizer on v, so small numbers spread over every bit.
+	v += 0x9E3779B97F4A7C15ull;
+	v = (v ^ (v >> 30)) * 0xBF58476D1CE4E5B9ull;
+	v = (v ^ (v >> 27)) * 0x94D049BB133111EBull;
+	v ^= v >> 31;
+	return (h ^ v) * FNV_PRIME;
+}
+
+uint64_t HashBytes(const uint8_t* p, size_t size, uint64_t seed)
+{
+	uint64_t h = seed;
+	for(size_t i = 0; i < size; i++) h = (h ^ p[i]) * FNV_PRIME;
+	return h;
+}
+
+uint64_t HashOpcodeBytes(const uint8_t* p, uint16_t size, uint8_t ptrPos)
+{
+	// FNV-1a
+	uint64_t h = FNV_OFFSET;
+	for(uint16_t i = 0; i < size; i++)
+	{
+		if(ptrPos && (i == ptrPos || i == ptrPos + 1)) continue;
+		h = (h ^ p[i]) * FNV_PRIME;
+	}
+	return h;
+}
+
+StructuralHasher::StructuralHasher()
+	: _opcodes(nullptr), _chunks(nullptr), _data(nullptr), _tableHashed(false)
+{
+}
+
+void StructuralHasher::Reset(
+	const OpcodeTable* opcodes,
+	const OpcodeChunk* chunks,
+	size_t chunkCount,
+	const uint8_t* data)
+{
+	_opcodes = opcodes;
+	_chunks = chunks;
+	_data = data;
+	_tableHashed = false;
+
+	// Own graph, as a model loaded from file comes without one.
+	_graph.Build(*opcodes, chunks, chunkCount);
+	_codeHash.assign(opcodes->count(), 0);
+	_codeHashed.assign(opcodes->count(), false);
+	_index.assign(opcodes->count(), 0);
+	_order.clear();
+}
+
+uint64_t StructuralHasher::GetLocalHash(OpcodeHandle opc) const
+{
+	return HashOpcodeBytes(
+		_data + _opcodes->offset[opc],
+		_opcodes->size[opc],
+		_opcodes->argOffset[opc]);
+}
+
+/*
+Hash components sinks first. Chunks end in a terminator and fall through
+only inside, so a chunk outside loops is hashed from its end. Loops are
+walked only from where something points into them : each pointer leaving
+a loop is hashed when the loop's turn comes, so walks never nest.
+*/
+void StructuralHasher::HashTable()
+{
+	for(uint32_t comp = 0; comp < _graph.GetComponentCount(); comp++)
+	{
+		uint32_t chunkCount;
+		const uint32_t* chunkIDs = _graph.GetComponentChunks(comp, &chunkCount);
+		if(_graph.IsCyclic(comp))
+		{
+			for(uint32_t i = 0; i < chunkCount; i++)
+			{
+				const OpcodeChunk& chk = _chunks[chunkIDs[i]];
+				for(OpcodeHandle opc = chk.first; opc < chk.first + chk.count; opc++)
+				{
+					OpcodeHandle target = _opcodes->target[opc];
+					if(target != NO_OPCODE &&
+						_graph.GetComponent(_opcodes->chunk[target]) != comp)
+					{
+						GetCodeHash(target);
+					}
+				}
+			}
+			continue;
+		}
+
+		const OpcodeChunk& chk = _chunks[chunkIDs[0]];
+		for(OpcodeHandle opc = chk.first + chk.count; opc-- > chk.first;)
+		{
+			uint64_t h = HashMix(FNV_OFFSET, GetLocalHash(opc));
+			h = HashMix(h, GetCodeHash(_opcodes->target[opc]));
+			h = HashMix(h, GetCodeHash(_opcodes->next[opc]));
+			_codeHash[opc] = h;
+			_codeHashed[opc] = true;
+		}
+	}
+	_tableHashed = true;
+}
+
+uint64_t StructuralHasher::GetCodeHash(OpcodeHandle opc)
+{
+	if(opc == NO_OPCODE) return 0;
+	if(!_codeHashed[opc])
+	{
+		_codeHash[opc] = HashLoop(opc);
+		_codeHashed[opc] = true;
+	}
+	return _codeHash[opc];
+}
+
+// Opcode seen from inside a loop of comp.
+uint64_t StructuralHasher::VisitLoop(uint32_t comp, OpcodeHandle opc)
+{
+	if(opc == NO_OPCODE) return 0;
+	if(_graph.GetComponent(_opcodes->chunk[opc]) != comp)
+	{
+		return HashMix(1, GetCodeHash(opc));  // Outside, so hashed already
+	}
+	if(_index[opc] == 0)
+	{
+		_order.push_back(opc);
+		_index[opc] = _order.size();
+	}
+	return HashMix(2, _index[opc]);
+}
+
+uint64_t StructuralHasher::HashLoop(OpcodeHandle opc)
+{
+	uint32_t comp = _graph.GetComponent(_opcodes->chunk[opc]);
+	uint64_t h = HashMix(FNV_OFFSET, VisitLoop(comp, opc));
+
+	// _order grows while being walked, which makes this a BFS.
+	for(size_t i = 0; i < _order.size(); i++)
+	{
+		OpcodeHandle o = _order[i];
+		h = HashMix(h, GetLocalHash(o));
+		h = HashMix(h, VisitLoop(comp, _opcodes->target[o]));
+		h = HashMix(h, VisitLoop(comp, _opcodes->next[o]));
+	}
+
+	for(OpcodeHandle o : _order) _index[o] = 0;
+	_order.clear();
+	return h;
+}
+
+uint64_t StructuralHasher::HashGraph(
+	uint64_t seed,
+	const OpcodeHandle* slots,
+	uint32_t slotCount)
+{
+	if(!_tableHashed) HashTable();
+
+	uint64_t h = HashMix(FNV_OFFSET, seed);
+	for(uint32_t i = 0; i < slotCount; i++) h = HashMix(h, GetCodeHash(slots[i]));
+	return h;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef STRUCTHASH_HEADER_
+#define STRUCTHASH_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "chunkgraph.h"
+#include "iscript_opcode.h"
+
+/*
+Structural hash of opcode graphs, for telling whether two entries have
+the same content regardless of where their opcodes are placed.
+
+Every opcode gets a code hash : its bytes with the pointer field left
+out, mixed with code hashes of its pointer target and next opcode. So
+equal code hashes mean equal code from there on, wherever it sits and
+whether or not it is shared. Entry hash mixes code hashes of the slots.
+
+Loops have no such bottom-up order. Code hash of an opcode inside a
+strongly connected component of the chunk graph instead walks that
+component in BFS order from the opcode, visiting the pointer target
+before the fall-through. Opcodes of the component stand for their BFS
+numbers, and anything outside it for its code hash.
+
+Code hashes are memoized per opcode. Components are taken in reverse
+topological order, so everything an opcode points out to is hashed
+already, and the table is hashed in linear time. Only an opcode in a
+loop that is reached from outside costs a walk of its component, once.
+*/
+
+// Mix v into running hash h. Order matters.
+uint64_t HashMix(uint64_t h, uint64_t v);
+
+// FNV-1a over size bytes from p, starting from seed instead of the usual
+// offset basis.
+uint64_t HashBytes(const uint8_t* p, size_t size, uint64_t seed);
+
+// Hash of opcode bytes with pointer field (at ptrPos, if nonzero) left out.
+uint64_t HashOpcodeBytes(const uint8_t* p, uint16_t size, uint8_t ptrPos);
+
+class StructuralHasher
+{
+public:
+	StructuralHasher();
+
+	// Forget memoized hashes. Call whenever opcode table is relinked.
+	void Reset(
+		const OpcodeTable* opcodes,
+		const OpcodeChunk* chunks,
+		size_t chunkCount,
+		const uint8_t* data);
+
+	// Hash of graph reachable from slots, mixed into seed.
+	uint64_t HashGraph(
+		uint64_t seed,
+		const OpcodeHandle* slots,
+		uint32_t slotCount);
+
+private:
+	void HashTable();
+	uint64_t GetLocalHash(OpcodeHandle opc) const;
+	uint64_t GetCodeHash(OpcodeHandle opc);
+	uint64_t HashLoop(OpcodeHandle opc);
+	uint64_t VisitLoop(uint32_t comp, OpcodeHandle opc);
+
+	const OpcodeTable* _opcodes;
+	const OpcodeChunk* _chunks;
+	const uint8_t* _data;
+	bool _tableHashed;
+
+	ChunkGraph _graph;
+	std::vector<uint64_t> _codeHash;
+	std::vector<bool> _codeHashed;
+
+	// BFS state of HashLoop. _index is 1 + BFS number, 0 if unvisited,
+	// and is cleared after each walk.
+	std::vector<uint32_t> _index;
+	std::vector<OpcodeHandle> _order;
+};
+
+#endif
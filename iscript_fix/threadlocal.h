@@ -0,0 +1,59 @@
+#pragma once
+
+#ifndef THREADLOCAL_HEADER_
+#define THREADLOCAL_HEADER_
+
+#include <cstdint>
+
+/*
+Pointer-sized value of each thread, zero until set. Declare it with
+THREAD_LOCAL_VALUE, at namespace scope.
+
+VS2013 has no thread_local, and static TLS of __declspec(thread) isn't
+set up on XP & 2003 in a DLL loaded with LoadLibrary, as iscript_lib is.
+There the value lives in a slot from TlsAlloc instead.
+*/
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+
+#include <Windows.h>
+
+template<typename T>
+class ThreadLocalValue
+{
+	static_assert(sizeof(T) <= sizeof(void*), "Value must fit in a TLS slot.");
+
+public:
+	ThreadLocalValue() : _slot(TlsAlloc()) {}
+	~ThreadLocalValue() { if(_slot != TLS_OUT_OF_INDEXES) TlsFree(_slot); }
+
+	// Without a slot, Get always returns zero.
+	T Get() const { return (T)(uintptr_t)TlsGetValue(_slot); }
+	void Set(T value) { TlsSetValue(_slot, (void*)(uintptr_t)value); }
+
+private:
+	ThreadLocalValue(const ThreadLocalValue&);
+	ThreadLocalValue& operator=(const ThreadLocalValue&);
+
+	DWORD _slot;
+};
+
+#define THREAD_LOCAL_VALUE(type, name) static ThreadLocalValue<type> name
+
+#else
+
+// No constructor, so it is zero-initialized like any other static.
+template<typename T>
+struct ThreadLocalValue
+{
+	T Get() const { return value; }
+	void Set(T newValue) { value = newValue; }
+
+	T value;
+};
+
+#define THREAD_LOCAL_VALUE(type, name) static thread_local ThreadLocalValue<type> name
+
+#endif
+
+#endif
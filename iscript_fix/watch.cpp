@@ -0,0 +1,150 @@
+#include "watch.h"
+#include "fixer.h"
+#include "instrument.h"
+#include "iscript.h"
+#include "iscriptdiff.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <chrono>
+#include <new>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+struct WatchedInput
+{
+	WatchedInput() : readable(true), fixed(false) {}
+
+	std::string ifname;
+	std::string ofname;
+	bool readable;  // To report a missing input once, not on every poll.
+	bool fixed;
+
+	// Bytes of last fixed version and model decoded from them. data is
+	// only ever swapped, so isc keeps pointing at its buffer.
+	std::vector<uint8_t> data;
+	std::unique_ptr<IScript> isc;
+	std::vector<uint8_t> output;  // Last written
+};
+
+static bool ReadWholeFile(const std::string& fname, std::vector<uint8_t>* data)
+{
+	std::ifstream is(fname, std::ifstream::binary);
+	if(!is) return false;
+	data->assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	return !is.bad();
+}
+
+static bool WriteOutput(const std::string& ofname, const std::vector<uint8_t>& output)
+{
+	FileFixOutput file(ofname);
+	uint8_t* p = file.Create((uint32_t)output.size());
+	if(p == nullptr) return false;
+	memcpy(p, output.data(), output.size());
+	return file.Commit();
+}
+
+static void Refix(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	WatchedInput* w,
+	std::vector<uint8_t>& data)
+{
+	Instrumentation inst;
+	SetInstrumentation(&inst);
+	std::string log;
+	SetLogCapture(&log);
+	double start = GetMonotonicMs();
+
+	FixStatus status = FIX_MALFORMED_INPUT;
+	std::vector<SourceEdit> edits;
+	std::unique_ptr<IScript> isc;
+	BufferFixOutput output;
+	try
+	{
+		isc = ReadEditedIScript(data.data(), data.size(),
+			w->isc.get(), w->data.data(), w->data.size(), &edits);
+		status = FixIScriptModel(orig, *isc, &output, options);
+	}
+	catch(const FatalErrorException& e)
+	{
+		Log("\n[Error] %s\n", e.what());
+	}
+	catch(const std::bad_alloc&)
+	{
+		Log("\n[Error] Out of memory.\n");
+		status = FIX_OUT_OF_MEMORY;
+	}
+	if(status == FIX_MALFORMED_INPUT || status == FIX_OUT_OF_MEMORY) isc.reset();
+	uint32_t changedBytes = 0;
+	for(const SourceEdit& edit : edits) changedBytes += edit.newSize;
+
+	bool written = false;
+	if(status == FIX_OK && output.buffer != w->output)
+	{
+		if(WriteOutput(w->ofname, output.buffer))
+		{
+			w->output.swap(output.buffer);
+			written = true;
+		}
+		else
+		{
+			Log("\n[Error] Cannot write %s.\n", w->ofname.c_str());
+			status = FIX_CANNOT_WRITE;
+		}
+	}
+	double ms = GetMonotonicMs() - start;
+	SetLogCapture(nullptr);
+	SetInstrumentation(nullptr);
+
+	if(status != FIX_OK) fputs(log.c_str(), stdout);
+	printf("[Watch] %s : %d bytes in %d edits, %d opcodes reused, %d decoded, %.1f ms, %s\n",
+		w->ifname.c_str(), (int)changedBytes, (int)edits.size(),
+		(int)inst.count[COUNT_REUSED_OPCODES], (int)inst.count[COUNT_OPCODES], ms,
+		status != FIX_OK ? "FAILED" : written ? "written" : "output unchanged");
+	fflush(stdout);
+
+	// Model of a version that couldn't be decoded is of no use later.
+	w->data.swap(data);
+	w->isc = std::move(isc);
+	w->fixed = true;
+}
+
+int RunWatch(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	const std::vector<std::string>& inputs)
+{
+	if(inputs.empty()) return -1;
+
+	std::vector<WatchedInput> watched(inputs.size());
+	for(size_t i = 0; i < inputs.size(); i++)
+	{
+		watched[i].ifname = inputs[i];
+		watched[i].ofname = GetFixedFileName(inputs[i]);
+	}
+	printf("[Watch] Watching %d inputs. Stop with Ctrl+C.\n", (int)inputs.size());
+	fflush(stdout);
+
+	std::vector<uint8_t> data;
+	while(true)
+	{
+		for(WatchedInput& w : watched)
+		{
+			bool readable = ReadWholeFile(w.ifname, &data);
+			if(readable != w.readable)
+			{
+				if(!readable) printf("[Watch] Cannot open %s.\n", w.ifname.c_str());
+				w.readable = readable;
+				fflush(stdout);
+			}
+			if(!readable || (w.fixed && data == w.data)) continue;
+			Refix(orig, options, &w, data);
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_POLL_MS));
+	}
+}
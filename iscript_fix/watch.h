@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef WATCH_HEADER_
+#define WATCH_HEADER_
+
+#include <string>
+#include <vector>
+
+struct FixOptions;
+struct OriginalIScript;
+
+/*
+Watch mode. Inputs are read every WATCH_POLL_MS and fixed again whenever
+their bytes change, until the process is stopped.
+
+Bytes and decoded model of each input are kept between runs. A changed
+input is diffed against the bytes before, and opcodes the edits left
+alone are taken over from the old model instead of being decoded again,
+see IScript::ReuseDecoded. Only decoding is incremental : allocation and
+emission run over the whole input on every change, and with -O or -d on
+a large mod they cost several times what reuse saves, however small the
+edit. The output file is rewritten only when its content changes. Each
+run prints one line, or its whole log on failure.
+*/
+
+const int WATCH_POLL_MS = 250;
+
+// Returns only when there is nothing to watch.
+int RunWatch(
+	const OriginalIScript& orig,
+	const FixOptions& options,
+	const std::vector<std::string>& inputs);
+
+#endif
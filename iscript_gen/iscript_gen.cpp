@@ -0,0 +1,94 @@
+/*
+Build step for iscript_fix. Reads original iscript.bin and writes its bytes
+out as a static table (origmodel.cpp), so iscript_fix needs no resource
+lookup. A broken entry table fails the build here. At startup the entry
+table is still read, and options needing it still decode the original, as
+for any other original : reading takes well under a millisecond, and a
+saved model (-m) barely speeds up what options build from it.
+
+Usage : iscript_gen [iscript.bin] [origmodel.cpp]
+*/
+
+#include <cstdio>
+#include <cstdint>
+
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+static bool ReadU16(const std::vector<uint8_t>& data, size_t offset, uint16_t* out)
+{
+	if(offset + 2 > data.size()) return false;
+	*out = data[offset] | (data[offset + 1] << 8);
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc != 3)
+	{
+		printf("Usage : iscript_gen [iscript.bin] [origmodel.cpp]\n");
+		return -1;
+	}
+
+	std::ifstream is(argv[1], std::ios::binary);
+	if(!is)
+	{
+		printf("[Error] Cannot open %s.\n", argv[1]);
+		return -1;
+	}
+	std::vector<uint8_t> data(
+		(std::istreambuf_iterator<char>(is)),
+		std::istreambuf_iterator<char>());
+	is.close();
+
+	// Walk entry table, to catch a broken iscript.bin. Same rules as
+	// IScript's constructor.
+	uint16_t dataend;
+	if(!ReadU16(data, 0, &dataend))
+	{
+		printf("[Error] %s is too small.\n", argv[1]);
+		return -1;
+	}
+
+	std::set<uint16_t> ids;
+	size_t entrylistoffset = dataend;
+	while(1)
+	{
+		uint16_t entryID, entryOffset;
+		if(!ReadU16(data, entrylistoffset, &entryID) ||
+			(entryID != 0xFFFF && !ReadU16(data, entrylistoffset + 2, &entryOffset)))
+		{
+			printf("[Error] Entry table of %s is truncated.\n", argv[1]);
+			return -1;
+		}
+		if(entryID == 0xFFFF) break;
+		ids.insert(entryID);
+		entrylistoffset += 4;
+	}
+
+	FILE* fp = fopen(argv[2], "wb");  // LF on every platform
+	if(!fp)
+	{
+		printf("[Error] Cannot write %s.\n", argv[2]);
+		return -1;
+	}
+
+	fprintf(fp, "// Generated by iscript_gen from iscript.bin. Do not edit.\n\n");
+	fprintf(fp, "#include \"origmodel.h\"\n\n");
+
+	fprintf(fp, "const uint8_t origIScriptData[%d] = {", (int)data.size());
+	for(size_t i = 0; i < data.size(); i++)
+	{
+		fprintf(fp, "%s0x%02x,", (i % 16) ? " " : "\n\t", data[i]);
+	}
+	fprintf(fp, "\n};\n");
+	fprintf(fp, "const size_t origIScriptSize = %d;\n", (int)data.size());
+
+	fclose(fp);
+	printf("Wrote %s : %d bytes, %d entries.\n",
+		argv[2], (int)data.size(), (int)ids.size());
+	return 0;
+}
@@ -0,0 +1,212 @@
+#include "iscriptfix.h"
+
+#include "../iscript_fix/fixer.h"
+#include "../iscript_fix/log.h"
+
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+struct iscriptfix_context
+{
+	std::vector<uint8_t> origData;  // Empty for bundled original
+	std::unique_ptr<OriginalIScript> orig;
+	FixOptions options;
+};
+
+struct iscriptfix_result
+{
+	iscriptfix_status status;
+	BufferFixOutput output;
+	std::string error;
+	std::string log;
+};
+
+static const uint32_t KNOWN_FLAGS =
+	ISCRIPTFIX_CONTENT_DIFF | ISCRIPTFIX_DEDUP | ISCRIPTFIX_OPTIMIZE |
+	ISCRIPTFIX_FILL_GAPS | ISCRIPTFIX_COMPACT;
+
+static iscriptfix_status ToAPIStatus(FixStatus status)
+{
+	switch(status)
+	{
+	case FIX_OK: return ISCRIPTFIX_OK;
+	case FIX_MALFORMED_INPUT: return ISCRIPTFIX_MALFORMED_INPUT;
+	case FIX_OVERFLOW: return ISCRIPTFIX_OVERFLOW;
+	case FIX_OUT_OF_MEMORY: return ISCRIPTFIX_OUT_OF_MEMORY;
+	default: return ISCRIPTFIX_INTERNAL_ERROR;  // Buffer output can't fail writing.
+	}
+}
+
+/*
+Library never prints : whatever fixing logs on calling thread goes to
+buffer while this is alive, then back to wherever it went before.
+*/
+class ScopedLogCapture
+{
+public:
+	explicit ScopedLogCapture(std::string* buffer) : _previous(GetLogCapture())
+	{
+		SetLogCapture(buffer);
+	}
+	~ScopedLogCapture() { SetLogCapture(_previous); }
+
+private:
+	std::string* _previous;
+};
+
+int ISCRIPTFIX_CALL iscriptfix_version(void)
+{
+	return ISCRIPTFIX_API_VERSION;
+}
+
+const char* ISCRIPTFIX_CALL iscriptfix_status_name(iscriptfix_status status)
+{
+	switch(status)
+	{
+	case ISCRIPTFIX_OK: return "ok";
+	case ISCRIPTFIX_INVALID_ARGUMENT: return "invalid argument";
+	case ISCRIPTFIX_MALFORMED_ORIGINAL: return "malformed original iscript";
+	case ISCRIPTFIX_MALFORMED_INPUT: return "malformed input iscript";
+	case ISCRIPTFIX_OVERFLOW: return "overflow";
+	case ISCRIPTFIX_OUT_OF_MEMORY: return "out of memory";
+	case ISCRIPTFIX_INTERNAL_ERROR: return "internal error";
+	default: return "unknown status";
+	}
+}
+
+iscriptfix_status ISCRIPTFIX_CALL iscriptfix_create(
+	const uint8_t* orig,
+	size_t origSize,
+	uint32_t flags,
+	iscriptfix_context** context,
+	iscriptfix_result** result)
+{
+	if(result) *result = nullptr;
+	if(context == nullptr) return ISCRIPTFIX_INVALID_ARGUMENT;
+	*context = nullptr;
+	if((flags & ~KNOWN_FLAGS) || (orig == nullptr && origSize != 0))
+	{
+		return ISCRIPTFIX_INVALID_ARGUMENT;
+	}
+
+	iscriptfix_result* res = new(std::nothrow) iscriptfix_result;
+	if(res == nullptr) return ISCRIPTFIX_OUT_OF_MEMORY;
+	try
+	{
+		ScopedLogCapture capture(&res->log);
+		std::unique_ptr<iscriptfix_context> ctx(new iscriptfix_context);
+		ctx->options.contentDiff = (flags & ISCRIPTFIX_CONTENT_DIFF) != 0;
+		ctx->options.dedup = (flags & ISCRIPTFIX_DEDUP) != 0;
+		ctx->options.optimize = (flags & ISCRIPTFIX_OPTIMIZE) != 0;
+		ctx->options.fillGaps = (flags & ISCRIPTFIX_FILL_GAPS) != 0;
+		ctx->options.compact = (flags & ISCRIPTFIX_COMPACT) != 0;
+		if(orig == nullptr) ctx->orig.reset(new OriginalIScript());
+		else
+		{
+			ctx->origData.assign(orig, orig + origSize);
+			ctx->orig.reset(new OriginalIScript(ctx->origData.data(), ctx->origData.size()));
+		}
+		ctx->orig->Prepare(ctx->options);
+		*context = ctx.release();
+		res->status = ISCRIPTFIX_OK;
+	}
+	catch(const FatalErrorException& e)
+	{
+		res->status = ISCRIPTFIX_MALFORMED_ORIGINAL;
+		res->error = e.what();
+	}
+	catch(const std::bad_alloc&)
+	{
+		res->status = ISCRIPTFIX_OUT_OF_MEMORY;
+	}
+	catch(...)
+	{
+		res->status = ISCRIPTFIX_INTERNAL_ERROR;
+	}
+	if(res->status != ISCRIPTFIX_OK && res->error.empty())
+	{
+		res->error = iscriptfix_status_name(res->status);
+	}
+
+	iscriptfix_status status = res->status;
+	if(result) *result = res;
+	else delete res;
+	return status;
+}
+
+void ISCRIPTFIX_CALL iscriptfix_destroy(iscriptfix_context* context)
+{
+	delete context;
+}
+
+iscriptfix_status ISCRIPTFIX_CALL iscriptfix_fix(
+	const iscriptfix_context* context,
+	const uint8_t* input,
+	size_t inputSize,
+	iscriptfix_result** result)
+{
+	if(result == nullptr) return ISCRIPTFIX_INVALID_ARGUMENT;
+	*result = nullptr;
+	if(context == nullptr || (input == nullptr && inputSize != 0))
+	{
+		return ISCRIPTFIX_INVALID_ARGUMENT;
+	}
+
+	iscriptfix_result* res = new(std::nothrow) iscriptfix_result;
+	if(res == nullptr) return ISCRIPTFIX_OUT_OF_MEMORY;
+	try
+	{
+		ScopedLogCapture capture(&res->log);
+		FixStatus status = FixIScriptData(
+			*context->orig, input, inputSize, &res->output, context->options, &res->error);
+		res->status = ToAPIStatus(status);
+		if(res->status != ISCRIPTFIX_OK) std::vector<uint8_t>().swap(res->output.buffer);
+	}
+	catch(const std::bad_alloc&)
+	{
+		res->status = ISCRIPTFIX_OUT_OF_MEMORY;
+	}
+	catch(...)
+	{
+		res->status = ISCRIPTFIX_INTERNAL_ERROR;
+	}
+	if(res->status != ISCRIPTFIX_OK && res->error.empty())
+	{
+		res->error = iscriptfix_status_name(res->status);
+	}
+	*result = res;
+	return res->status;
+}
+
+iscriptfix_status ISCRIPTFIX_CALL iscriptfix_result_status(const iscriptfix_result* result)
+{
+	return result ? result->status : ISCRIPTFIX_INVALID_ARGUMENT;
+}
+
+const uint8_t* ISCRIPTFIX_CALL iscriptfix_result_data(const iscriptfix_result* result)
+{
+	if(result == nullptr || result->output.buffer.empty()) return nullptr;
+	return result->output.buffer.data();
+}
+
+size_t ISCRIPTFIX_CALL iscriptfix_result_size(const iscriptfix_result* result)
+{
+	return result ? result->output.buffer.size() : 0;
+}
+
+const char* ISCRIPTFIX_CALL iscriptfix_result_error(const iscriptfix_result* result)
+{
+	return result ? result->error.c_str() : "";
+}
+
+const char* ISCRIPTFIX_CALL iscriptfix_result_log(const iscriptfix_result* result)
+{
+	return result ? result->log.c_str() : "";
+}
+
+void ISCRIPTFIX_CALL iscriptfix_result_free(iscriptfix_result* result)
+{
+	delete result;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef ISCRIPTFIX_HEADER_
+#define ISCRIPTFIX_HEADER_
+
+/*
+C interface of iscript_fix, for fixing iscripts in-process.
+
+A context holds a decoded original iscript and the options to fix with.
+Creating it is the slow part, so keep it around and fix every input
+through it. Fixing only reads the context, so several threads may fix
+through one context at once.
+
+Nothing here aborts or prints. Every call returns a status. Fixing hands
+back a result with the fixed iscript, the log of the run and, on
+failure, a one-line error message.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define ISCRIPTFIX_CALL __cdecl
+#ifdef ISCRIPTFIX_EXPORTS
+#define ISCRIPTFIX_API __declspec(dllexport)
+#else
+#define ISCRIPTFIX_API __declspec(dllimport)
+#endif
+#else
+#define ISCRIPTFIX_CALL
+#define ISCRIPTFIX_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped on every incompatible change. Compare with iscriptfix_version().
+#define ISCRIPTFIX_API_VERSION 2
+
+// Values never change meaning. New ones only get added at the end.
+typedef enum iscriptfix_status
+{
+	ISCRIPTFIX_OK = 0,
+	ISCRIPTFIX_INVALID_ARGUMENT = 1,
+	ISCRIPTFIX_MALFORMED_ORIGINAL = 2,
+	ISCRIPTFIX_MALFORMED_INPUT = 3,
+	ISCRIPTFIX_OVERFLOW = 4,  // Result doesn't fit in 64KB.
+	ISCRIPTFIX_OUT_OF_MEMORY = 5,
+	ISCRIPTFIX_INTERNAL_ERROR = 6,
+} iscriptfix_status;
+
+// Options, same as command line flags of iscript_fix.
+#define ISCRIPTFIX_CONTENT_DIFF 0x01  // -c
+#define ISCRIPTFIX_DEDUP 0x02  // -d
+#define ISCRIPTFIX_OPTIMIZE 0x04  // -O
+#define ISCRIPTFIX_FILL_GAPS 0x08  // -g
+#define ISCRIPTFIX_COMPACT 0x10  // -C
+
+typedef struct iscriptfix_context iscriptfix_context;
+typedef struct iscriptfix_result iscriptfix_result;
+
+ISCRIPTFIX_API int ISCRIPTFIX_CALL iscriptfix_version(void);
+
+// Short English name of status, like "overflow".
+ISCRIPTFIX_API const char* ISCRIPTFIX_CALL iscriptfix_status_name(iscriptfix_status status);
+
+/*
+Decode original iscript and prepare what flags need. With orig NULL, the
+iscript.bin built into the library is used. Otherwise orig is copied, so
+it may be freed right after. On failure *context is NULL.
+
+result may be NULL. Otherwise *result is set like by iscriptfix_fix, with
+the log of preparing and, on failure, the error, but never any data.
+*/
+ISCRIPTFIX_API iscriptfix_status ISCRIPTFIX_CALL iscriptfix_create(
+	const uint8_t* orig,
+	size_t origSize,
+	uint32_t flags,
+	iscriptfix_context** context,
+	iscriptfix_result** result);
+
+ISCRIPTFIX_API void ISCRIPTFIX_CALL iscriptfix_destroy(iscriptfix_context* context);
+
+/*
+Fix user iscript in input. *result is set whenever the call got as far as
+running the fix, successful or not, and must be freed with
+iscriptfix_result_free. Input isn't kept past the call.
+*/
+ISCRIPTFIX_API iscriptfix_status ISCRIPTFIX_CALL iscriptfix_fix(
+	const iscriptfix_context* context,
+	const uint8_t* input,
+	size_t inputSize,
+	iscriptfix_result** result);
+
+ISCRIPTFIX_API iscriptfix_status ISCRIPTFIX_CALL iscriptfix_result_status(const iscriptfix_result* result);
+// Fixed iscript. NULL & 0 unless status is ISCRIPTFIX_OK.
+ISCRIPTFIX_API const uint8_t* ISCRIPTFIX_CALL iscriptfix_result_data(const iscriptfix_result* result);
+ISCRIPTFIX_API size_t ISCRIPTFIX_CALL iscriptfix_result_size(const iscriptfix_result* result);
+// Empty unless status is an error.
+ISCRIPTFIX_API const char* ISCRIPTFIX_CALL iscriptfix_result_error(const iscriptfix_result* result);
+// What iscript_fix would have printed.
+ISCRIPTFIX_API const char* ISCRIPTFIX_CALL iscriptfix_result_log(const iscriptfix_result* result);
+ISCRIPTFIX_API void ISCRIPTFIX_CALL iscriptfix_result_free(iscriptfix_result* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/*
+Checks of the iscript_lib C interface, run against the library the way an
+editor embeds it.
+
+Usage : iscript_libtest [-c] [-d] [-O] [-g] [-C] [input] [fixed input]
+
+fixed input is what iscript_fix wrote for input with the same options.
+Checked are that:
+ - the library gives back exactly those bytes,
+ - every truncated input fails cleanly as malformed,
+ - input grown past 64KB with trailing bytes still fixes to those bytes,
+ - several threads fixing through one context all get those bytes,
+ - a broken original and bad arguments fail without a context.
+Prints one line per check, and returns 0 only when all of them pass.
+*/
+
+#include "../iscript_lib/iscriptfix.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+static bool ReadWholeFile(const char* fname, std::vector<uint8_t>* data)
+{
+	std::ifstream is(fname, std::ifstream::binary);
+	if(!is) return false;
+	data->assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	return !is.bad();
+}
+
+static int s_failed = 0;
+
+static void Check(bool ok, const char* what)
+{
+	printf("%s %s\n", ok ? "[Pass]" : "[Fail]", what);
+	if(!ok) s_failed++;
+}
+
+// Status of fixing input through context. With output given, bytes of a
+// successful fix go there. A result that doesn't match its status, like a
+// failure handing back data or no error, counts as an internal error.
+static iscriptfix_status Fix(
+	const iscriptfix_context* context,
+	const uint8_t* input,
+	size_t inputSize,
+	std::vector<uint8_t>* output)
+{
+	iscriptfix_result* result = nullptr;
+	iscriptfix_status status = iscriptfix_fix(context, input, inputSize, &result);
+	if(result == nullptr) return status;
+
+	const uint8_t* data = iscriptfix_result_data(result);
+	size_t size = iscriptfix_result_size(result);
+	bool consistent = iscriptfix_result_status(result) == status;
+	if(status == ISCRIPTFIX_OK)
+	{
+		if(output) output->assign(data, data + size);
+	}
+	else
+	{
+		consistent = consistent && data == nullptr && size == 0 &&
+			iscriptfix_result_error(result)[0] != '\0';
+	}
+	iscriptfix_result_free(result);
+	return consistent ? status : ISCRIPTFIX_INTERNAL_ERROR;
+}
+
+int main(int argc, char* argv[])
+{
+	uint32_t flags = 0;
+	int argi = 1;
+	for(; argi < argc && argv[argi][0] == '-'; argi++)
+	{
+		if(strcmp(argv[argi], "-c") == 0) flags |= ISCRIPTFIX_CONTENT_DIFF;
+		else if(strcmp(argv[argi], "-d") == 0) flags |= ISCRIPTFIX_DEDUP;
+		else if(strcmp(argv[argi], "-O") == 0) flags |= ISCRIPTFIX_OPTIMIZE;
+		else if(strcmp(argv[argi], "-g") == 0) flags |= ISCRIPTFIX_FILL_GAPS;
+		else if(strcmp(argv[argi], "-C") == 0) flags |= ISCRIPTFIX_COMPACT;
+		else
+		{
+			printf("[Error] Unknown option %s.\n", argv[argi]);
+			return -1;
+		}
+	}
+	if(argc - argi != 2)
+	{
+		printf("Usage : iscript_libtest [-c] [-d] [-O] [-g] [-C] [input] [fixed input]\n");
+		return -1;
+	}
+
+	std::vector<uint8_t> input, expected;
+	if(!ReadWholeFile(argv[argi], &input) || !ReadWholeFile(argv[argi + 1], &expected))
+	{
+		printf("[Error] Cannot read %s or %s.\n", argv[argi], argv[argi + 1]);
+		return -1;
+	}
+
+	Check(iscriptfix_version() == ISCRIPTFIX_API_VERSION, "Version matches header");
+
+	iscriptfix_context* context = nullptr;
+	iscriptfix_result* createResult = nullptr;
+	iscriptfix_status status = iscriptfix_create(nullptr, 0, flags, &context, &createResult);
+	Check(status == ISCRIPTFIX_OK && context != nullptr &&
+		createResult != nullptr && iscriptfix_result_size(createResult) == 0,
+		"Context of bundled original");
+	iscriptfix_result_free(createResult);
+	if(context == nullptr) return -1;
+
+	std::vector<uint8_t> output;
+	status = Fix(context, input.data(), input.size(), &output);
+	Check(status == ISCRIPTFIX_OK && output == expected, "Same bytes as iscript_fix");
+
+	// Cutting anywhere before the end of the entry table terminator leaves
+	// the table short, or its offset past the end. Every cut near either
+	// end, and a spread of the rest.
+	size_t tableEnd = input.size() >= 2 ? input[0] | (input[1] << 8) : 0;
+	while(tableEnd + 2 <= input.size() &&
+		(input[tableEnd] != 0xFF || input[tableEnd + 1] != 0xFF))
+	{
+		tableEnd += 4;
+	}
+	tableEnd += 2;
+	bool truncatedOk = true;
+	for(size_t size = 0; size < tableEnd && size < input.size(); size++)
+	{
+		bool nearEnd = size < 64 || tableEnd - size <= 64;
+		if(!nearEnd && size % 97 != 0) continue;
+		if(Fix(context, input.data(), size, nullptr) != ISCRIPTFIX_MALFORMED_INPUT)
+		{
+			printf(" - %d of %d bytes didn't fail as malformed.\n", (int)size, (int)input.size());
+			truncatedOk = false;
+		}
+	}
+	Check(truncatedOk, "Truncated inputs fail as malformed");
+
+	// Nothing reads past the entry table terminator.
+	std::vector<uint8_t> grown(input);
+	grown.resize(0x10000 + input.size(), 0xCC);
+	output.clear();
+	status = Fix(context, grown.data(), grown.size(), &output);
+	Check(status == ISCRIPTFIX_OK && output == expected, "Input grown past 64KB");
+
+	const unsigned threadCount = 4;
+	const int fixesPerThread = 8;
+	std::vector<int> matches(threadCount, 0);
+	std::vector<std::thread> threads;
+	for(unsigned t = 0; t < threadCount; t++)
+	{
+		threads.push_back(std::thread([&, t]()
+		{
+			std::vector<uint8_t> threadOutput;
+			for(int i = 0; i < fixesPerThread; i++)
+			{
+				threadOutput.clear();
+				if(Fix(context, input.data(), input.size(), &threadOutput) == ISCRIPTFIX_OK &&
+					threadOutput == expected)
+				{
+					matches[t]++;
+				}
+			}
+		}));
+	}
+	bool threadsOk = true;
+	for(unsigned t = 0; t < threadCount; t++)
+	{
+		threads[t].join();
+		threadsOk = threadsOk && matches[t] == fixesPerThread;
+	}
+	Check(threadsOk, "Threads fixing through one context");
+	iscriptfix_destroy(context);
+
+	// Entry table offset past the end.
+	const uint8_t brokenOrig[] = { 0xFF, 0x7F, 0x00, 0x00 };
+	context = nullptr;
+	createResult = nullptr;
+	status = iscriptfix_create(
+		brokenOrig, sizeof(brokenOrig), flags, &context, &createResult);
+	Check(status == ISCRIPTFIX_MALFORMED_ORIGINAL && context == nullptr &&
+		createResult != nullptr && iscriptfix_result_error(createResult)[0] != '\0',
+		"Broken original reports its error");
+	iscriptfix_result_free(createResult);
+	iscriptfix_destroy(context);
+
+	iscriptfix_result* result = nullptr;
+	Check(iscriptfix_create(nullptr, 0, 0x80000000u, &context, nullptr) ==
+		ISCRIPTFIX_INVALID_ARGUMENT && context == nullptr,
+		"Unknown flags are refused");
+	Check(iscriptfix_fix(nullptr, input.data(), input.size(), &result) ==
+		ISCRIPTFIX_INVALID_ARGUMENT && result == nullptr,
+		"Fixing without a context is refused");
+
+	if(s_failed) printf("[Error] %d checks failed.\n", s_failed);
+	else printf("All checks passed.\n");
+	return s_failed ? -1 : 0;
+}